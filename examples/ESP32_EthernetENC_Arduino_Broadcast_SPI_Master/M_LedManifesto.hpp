@@ -24,6 +24,21 @@
 // #define BLUE_MANIFESTO_DEBUG
 
 
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAY BELOW ARE CORRECT!
+
+// The Action pair name and description shouldn't be greater than 40 chars
+// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
+
+// ------------- MAXIMUM SIZE RULER --------------|
+//	 "name", "123456789012345678901234567890123456"
+// Kept in flash (PROGMEM), so, only the Manifesto pointer takes RAM
+const FlashAction led_actions[3] PROGMEM = {
+	{"on", "Turns led ON", "-"},
+	{"off", "Turns led OFF", "-"},
+	{"state", "The actual state of the led", "-"}
+};
+
+
 class M_LedManifesto : public TalkerManifesto {
 public:
 
@@ -45,26 +60,13 @@ public:
 
 protected:
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
-
-	// The Action pair name and description shouldn't be greater than 40 chars
-	// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
-
-	// ------------- MAXIMUM SIZE RULER --------------|
-	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[3] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"},
-		{"state", "The actual state of the led"}
-    };
-    
 	const uint8_t _led_pin;
     bool _is_led_on = false;	// keep track of the led state, by default it's off
 
 public:
     
-    const Action* _getActionsArray() const override { return actions; }
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    const FlashAction* _getFlashActionsArray() const override { return led_actions; }
+    uint8_t _actionsCount() const override { return sizeof(led_actions)/sizeof(FlashAction); }
 
 
     // Index-based operations (simplified examples)
@@ -28,6 +28,11 @@
 // #define BROADCAST_ETHERNETENC_DEBUG_NEW
 
 #define ENABLE_DIRECT_ADDRESSING
+// #define ENABLE_FRAME_BATCHING	// All Sockets in the LAN must have it enabled to receive batches
+
+#if defined(ENABLE_FRAME_BATCHING) && defined(TALKIE_NO_BATCHING)
+#error "ENABLE_FRAME_BATCHING needs the batching left out by TALKIE_NO_BATCHING, in AVR boards set TALKIE_PROFILE_FULL"
+#endif
 
 
 class S_EthernetENC_Broadcast : public BroadcastSocket {
@@ -42,12 +47,14 @@ protected:
 	IPAddress _my_ip;
     uint16_t _port = 5005;
     EthernetENC_BroadcastUDP* _udp = nullptr;
+	IPAddress _group_ip;	// 0.0.0.0 sends in broadcast, otherwise to this multicast group only
+
+	PeerTable _peers;	// The Talkers replied in unicast
 
-	struct FromTalker {
-		char name[TALKIE_NAME_LEN] = {'\0'};
-		IPAddress ip_address;
-	};
-	FromTalker _from_talker;
+	#ifdef ENABLE_FRAME_BATCHING
+	char _batch_sending[TALKIE_BATCH_SIZE];
+	char _batch_received[TALKIE_BATCH_SIZE];
+	#endif
 
 	
     // Constructor
@@ -79,6 +86,16 @@ protected:
 				Serial.println(_udp->remoteIP());
 				#endif
 
+				#ifdef ENABLE_FRAME_BATCHING
+				if (_udp->peek() == '[') {	// A batch of frames
+					if (packetSize <= TALKIE_BATCH_SIZE
+						&& _udp->read(_batch_received, static_cast<size_t>(packetSize)) == packetSize) {
+						_startBatchTransmission(_batch_received, static_cast<size_t>(packetSize));
+					}
+					return;
+				}
+				#endif
+
 				JsonMessage new_message;
 				char* message_buffer = new_message._write_buffer((size_t)packetSize);
 				if (!message_buffer) return;	// Avoids overflow
@@ -97,10 +114,9 @@ protected:
 	void _showMessage(const JsonMessage& json_message) override {
 
 		if (json_message.has_from()) {
-			json_message.get_from_name(_from_talker.name);
-			_from_talker.ip_address = _udp->remoteIP();
+			_peers.learn(json_message, (uint32_t)_udp->remoteIP());
 		} else if (json_message.is_noise()) {	// Reset name keeping
-			_from_talker.name[0] = '\0';	// Resets the from talker data
+			_peers.forget();	// Resets the from talkers data
 			return;	// It came from a Socket, no need to lose more time
 		}
 	}
@@ -110,11 +126,25 @@ protected:
 		
         if (_udp) {
 			
-            IPAddress broadcastIP(255, 255, 255, 255);
+            IPAddress broadcastIP = (uint32_t)_group_ip ? _group_ip : IPAddress(255, 255, 255, 255);
 
             #ifdef ENABLE_DIRECT_ADDRESSING
+			uint32_t peer_ip = (uint32_t)broadcastIP;
+			bool as_reply = _peers.find(json_message, &peer_ip);
+			IPAddress replyIP(peer_ip);
+            #endif
 
-			bool as_reply = json_message.is_to_name(_from_talker.name);
+            #ifdef ENABLE_FRAME_BATCHING
+			if (_batch_window_us) {
+				#ifdef ENABLE_DIRECT_ADDRESSING
+				return _batchFrame(json_message, peer_ip);
+				#else
+				return _batchFrame(json_message, (uint32_t)broadcastIP);
+				#endif
+			}
+            #endif
+
+            #ifdef ENABLE_DIRECT_ADDRESSING
 
 			#ifdef BROADCAST_ETHERNETENC_DEBUG_NEW
 			Serial.print(F("\t\t\t\t\tsend orgn: "));
@@ -133,7 +163,7 @@ protected:
 			Serial.println(json_message.get_length());
 			#endif
 
-            if (!_udp->beginPacket(as_reply ? _from_talker.ip_address : broadcastIP, _port)) {
+            if (!_udp->beginPacket(as_reply ? replyIP : broadcastIP, _port)) {
                 #ifdef BROADCAST_ETHERNETENC_DEBUG
                 Serial.println(F("\tFailed to begin packet"));
                 #endif
@@ -141,15 +171,17 @@ protected:
             } else {
 				
 				#ifdef BROADCAST_ETHERNETENC_DEBUG
-				if (as_reply && _from_talker.ip_address != broadcastIP) {
+				if (as_reply && replyIP != broadcastIP) {
 
 					Serial.print(F("\tsend1: --> Directly sent to the  "));
-					Serial.print(_from_talker.ip_address);
+					Serial.print(replyIP);
 					Serial.print(F(" address --> "));
 					
 				} else {
 					
-					Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+					Serial.print(F("\tsend1: --> Broadcast sent to the "));
+					Serial.print(broadcastIP);
+					Serial.print(F(" address --> "));
 					
 				}
 				#endif
@@ -163,7 +195,9 @@ protected:
             } else {
 									
 				#ifdef BROADCAST_ETHERNETENC_DEBUG
-				Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+				Serial.print(F("\tsend1: --> Broadcast sent to the "));
+				Serial.print(broadcastIP);
+				Serial.print(F(" address --> "));
 				#endif
 
 			}
@@ -196,6 +230,18 @@ protected:
     }
 
 
+	#ifdef ENABLE_FRAME_BATCHING
+	bool _sendBatch(const char* datagram, size_t length, uint32_t destination) override {
+
+		if (_udp && _udp->beginPacket(IPAddress(destination), _port)) {
+			_udp->write(reinterpret_cast<const uint8_t*>(datagram), length);
+			return _udp->endPacket() != 0;
+		}
+		return false;
+	}
+	#endif
+
+
 public:
 
     // Move ONLY the singleton instance method to subclass
@@ -206,11 +252,42 @@ public:
 
 
     void set_port(uint16_t port) { _port = port; }
+
+    /** @brief The Talkers replied in unicast, with the hit rate of the messages sent to them by name */
+    const PeerTable& get_peers() const { return _peers; }
+
+	#ifdef ENABLE_FRAME_BATCHING
+    /**
+     * @brief Enables the batching of frames into single datagrams
+     * @param window_us The maximum time a frame waits for other frames, `0` disables batching
+     */
+	void set_batching(uint16_t window_us) { _enableBatching(_batch_sending, TALKIE_BATCH_SIZE, window_us); }
+	#endif
+
     void set_udp(EthernetENC_BroadcastUDP* udp) {
         
         _udp = udp;
     }
 
+    /**
+     * @brief Joins a multicast group, so that only the Sockets in the same group (topic) get the messages
+     * @param group_ip A multicast address, like 239.255.0.1, or 0.0.0.0 to go back to broadcast
+     * @return true if the UDP restarted in the group
+     *
+     * @note Call it after `set_udp`, it restarts the UDP in the same port. The ENC28J60 accepts all
+     *       multicast frames, so, it's the library that drops the ones of other groups, one at a time.
+     */
+    bool set_multicast(IPAddress group_ip) {
+		if (!_udp) return false;
+		_group_ip = group_ip;
+		_peers.forget();
+		_udp->stop();
+		if (!(uint32_t)_group_ip) return _udp->begin(_port);
+		return _udp->beginMulticast(_group_ip, _port);
+    }
+
+    IPAddress get_multicast() const { return _group_ip; }
+
 };
 
 #endif // ETHERNETENC_BROADCAST_HPP
@@ -18,6 +18,7 @@
 #define MESSAGE_TESTER_MANIFESTO_HPP
 
 #include <TalkerManifesto.hpp>
+#include <ActionsIndex.hpp>
 
 // #define MESSAGE_TESTER_DEBUG
 // #define MESSAGE_TESTER_DEBUG_NEW
@@ -25,14 +26,14 @@
 
 using MessageValue = TalkieCodes::MessageValue;
 
-class M_MessageTester : public TalkerManifesto {
+class M_MessageTester : public IndexedManifesto<M_MessageTester> {
 public:
 
 	// The Manifesto class description shouldn't be greater than 42 chars
 	// {"m":7,"f":"","s":1,"b":1,"t":"","i":58485,"0":"","1":1,"c":11266} <-- 128 - (66 + 2*10) = 42
     const char* class_description() const override { return "M_MessageTester"; }
 
-    M_MessageTester() : TalkerManifesto()
+    M_MessageTester() : IndexedManifesto()
 	{
 	}	// Constructor
 
@@ -41,8 +42,6 @@ public:
 	}	// Destructor
 
 
-protected:
-
 	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
 
 	// The Action pair name and description shouldn't be greater than 40 chars
@@ -50,7 +49,7 @@ protected:
 
 	// ------------- MAXIMUM SIZE RULER --------------|
 	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[18] = {
+    static constexpr Action actions[18] = {
 		{"all", "Tests all methods"},
 		{"parse_json", "Test deserialize (fill up)"},
 		{"compare", "Test if it's the same"},
@@ -71,12 +70,7 @@ protected:
 		{"invalid", "Tries to get an oversized name"}
     };
     
-public:
-    
-    const Action* _getActionsArray() const override { return actions; }
-
-    // Size methods
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    // Calls by name are found with a binary search given by the `IndexedManifesto` (ActionsIndex.hpp)
 
 
     // Index-based operations (simplified examples)
@@ -366,4 +360,7 @@ public:
 };
 
 
+constexpr Action M_MessageTester::actions[18];	// Only needed before C++17
+
+
 #endif // MESSAGE_TESTER_MANIFESTO_HPP
@@ -46,9 +46,9 @@ protected:
 	// ------------- MAXIMUM SIZE RULER --------------|
 	//	 "name", "123456789012345678901234567890123456"
     const Action actions[3] = {
-		{"ping", "Ping talkers by name or channel"},
-		{"ping_self", "I can even ping myself"},
-		{"call", "Able to do [<talker> <action>]"}
+		{"ping", "Ping talkers by name or channel", "V"},
+		{"ping_self", "I can even ping myself", "-"},
+		{"call", "Able to do [<talker> <action>]", "vv"}
     };
     
 	char _original_talker[TALKIE_NAME_LEN];
@@ -63,7 +63,8 @@ public:
 
 
     // Action implementations - MUST be implemented by derived
-    bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
+    bool _actionByArguments(uint8_t index, JsonTalker& talker, JsonMessage& json_message,
+			const JsonMessage::Arguments& arguments, TalkerMatch talker_match) override {
 		(void)talker_match;	// Silence unused parameter warning
 		
 		bool ping = false;
@@ -79,20 +80,19 @@ public:
 				{
 					ping = true;
 
-					// 1. Start by collecting info from message
+					// 1. Start by collecting info from message (the arguments are read before any change)
 					json_message.get_from_name(_original_talker);
 					_trace_message_timestamp = json_message.get_identity();
+					char value_name[TALKIE_NAME_LEN];
+					const bool by_name = arguments.get_string(0, value_name, TALKIE_NAME_LEN);
 
 					// 2. Repurpose it to be a LOCAL PING
 					json_message.set_message_value(MessageValue::TALKIE_MSG_PING);
 					json_message.remove_identity();
-					if (json_message.get_nth_value_type(0) == ValueType::TALKIE_VT_STRING) {
-						char value_name[TALKIE_NAME_LEN];
-						if (json_message.get_nth_value_string(0, value_name, TALKIE_NAME_LEN)) {
-							json_message.set_to_name(value_name);
-						}
-					} else if (json_message.get_nth_value_type(0) == ValueType::TALKIE_VT_INTEGER) {
-						json_message.set_to_channel((uint8_t)json_message.get_nth_value_number(0));
+					if (by_name) {
+						json_message.set_to_name(value_name);
+					} else if (arguments.get_type(0) == ValueType::TALKIE_VT_INTEGER) {
+						json_message.set_to_channel((uint8_t)arguments.get_number(0));
 					} else {	// Removes the original TO
 						json_message.remove_to();	// Without TO works as broadcast
 					}
@@ -128,26 +128,24 @@ public:
 				{
 					ping = true;
 
-					// 1. Start by setting the Action fields
-					if (json_message.get_nth_value_type(0) == ValueType::TALKIE_VT_STRING) {
-						char value_name[TALKIE_NAME_LEN];
-						if (json_message.get_nth_value_string(0, value_name, TALKIE_NAME_LEN)) {
-							json_message.set_to_name(value_name);
-						}
-					} else if (json_message.get_nth_value_type(0) == ValueType::TALKIE_VT_INTEGER) {
-						json_message.set_to_channel((uint8_t)json_message.get_nth_value_number(0));
+					// 1. Start by setting the Action fields, the schema guarantees both values (the strings are read first)
+					char value_name[TALKIE_NAME_LEN];
+					char action_name[TALKIE_NAME_LEN];
+					const bool by_name = arguments.get_string(0, value_name, TALKIE_NAME_LEN);
+					const bool by_action_name = arguments.get_string(1, action_name, TALKIE_NAME_LEN);
+					if (by_name) {
+						json_message.set_to_name(value_name);
+					} else if (arguments.get_type(0) == ValueType::TALKIE_VT_INTEGER) {
+						json_message.set_to_channel((uint8_t)arguments.get_number(0));
 					} else {
-						return false;
+						return false;	// Not a valid name
 					}
-					if (json_message.get_nth_value_type(1) == ValueType::TALKIE_VT_STRING) {
-						char action_name[TALKIE_NAME_LEN];
-						if (json_message.get_nth_value_string(1, action_name, TALKIE_NAME_LEN)) {
-							json_message.set_action_name(action_name);
-						}
-					} else if (json_message.get_nth_value_type(1) == ValueType::TALKIE_VT_INTEGER) {
-						json_message.set_action_index((uint8_t)json_message.get_nth_value_number(1));
+					if (by_action_name) {
+						json_message.set_action_name(action_name);
+					} else if (arguments.get_type(1) == ValueType::TALKIE_VT_INTEGER) {
+						json_message.set_action_index((uint8_t)arguments.get_number(1));
 					} else {
-						return false;
+						return false;	// Not a valid name
 					}
 					json_message.remove_nth_value(0);
 					json_message.set_message_value(MessageValue::TALKIE_MSG_CALL);
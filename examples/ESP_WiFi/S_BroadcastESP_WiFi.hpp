@@ -28,6 +28,11 @@
 // #define BROADCAST_ESP_WIFI_DEBUG_NEW
 
 #define ENABLE_DIRECT_ADDRESSING
+// #define ENABLE_FRAME_BATCHING	// All Sockets in the LAN must have it enabled to receive batches
+
+#if defined(ENABLE_FRAME_BATCHING) && defined(TALKIE_NO_BATCHING)
+#error "ENABLE_FRAME_BATCHING needs the batching left out by TALKIE_NO_BATCHING, in AVR boards set TALKIE_PROFILE_FULL"
+#endif
 
 
 class S_BroadcastESP_WiFi : public BroadcastSocket {
@@ -42,12 +47,14 @@ protected:
 	IPAddress _my_ip;
 	uint16_t _port = 5005;
 	WiFiUDP* _udp;
+	IPAddress _group_ip;	// 0.0.0.0 sends in broadcast, otherwise to this multicast group only
 
-	struct FromTalker {
-		char name[TALKIE_NAME_LEN] = {'\0'};
-		IPAddress ip_address;
-	};
-	FromTalker _from_talker;
+	PeerTable _peers;	// The Talkers replied in unicast
+
+	#ifdef ENABLE_FRAME_BATCHING
+	char _batch_sending[TALKIE_BATCH_SIZE];
+	char _batch_received[TALKIE_BATCH_SIZE];
+	#endif
 
 
     // Constructor
@@ -60,6 +67,7 @@ protected:
 
 			if (WiFi.localIP() != _my_ip) {
 				_my_ip = WiFi.localIP();
+				if ((uint32_t)_group_ip) set_multicast(_group_ip);	// The group membership is per interface address
 				JsonMessage noise_message;
 				// No need for broadcast setting, it's for same LAN Sockets only
 				noise_message.set_message_value(MessageValue::TALKIE_MSG_NOISE);
@@ -101,6 +109,16 @@ protected:
 					
 				}
 
+				#ifdef ENABLE_FRAME_BATCHING
+				if (_udp->peek() == '[') {	// A batch of frames
+					if (packetSize <= TALKIE_BATCH_SIZE
+						&& _udp->read(_batch_received, static_cast<size_t>(packetSize)) == packetSize) {
+						_startBatchTransmission(_batch_received, static_cast<size_t>(packetSize));
+					}
+					return;
+				}
+				#endif
+
 				JsonMessage new_message;
 				char* message_buffer = new_message._write_buffer((size_t)packetSize);
 				if (!message_buffer) return;	// Avoids overflow
@@ -129,24 +147,48 @@ protected:
 	void _showMessage(const JsonMessage& json_message) override {
 
 		if (json_message.has_from()) {
-			json_message.get_from_name(_from_talker.name);
-			_from_talker.ip_address = _udp->remoteIP();
+			_peers.learn(json_message, (uint32_t)_udp->remoteIP());
 		} else if (json_message.is_noise()) {	// Reset name keeping
-			_from_talker.name[0] = '\0';	// Resets the from talker data
+			_peers.forget();	// Resets the from talkers data
 			return;	// It came from a Socket, no need to lose more time
 		}
 	}
 
 
+	int _beginPacket(IPAddress ip_address) {
+		#if defined(ESP8266)
+		// The ESP8266 only sends to a group through the given interface
+		if ((uint32_t)_group_ip && ip_address == _group_ip) {
+			return _udp->beginPacketMulticast(_group_ip, _port, WiFi.localIP());
+		}
+		#endif
+		return _udp->beginPacket(ip_address, _port);
+	}
+
+
     bool _send(const JsonMessage& json_message) override {
 		
         if (_udp) {
 			
-            IPAddress broadcastIP(255, 255, 255, 255);
+            IPAddress broadcastIP = (uint32_t)_group_ip ? _group_ip : IPAddress(255, 255, 255, 255);
 
             #ifdef ENABLE_DIRECT_ADDRESSING
+			uint32_t peer_ip = (uint32_t)broadcastIP;
+			bool as_reply = _peers.find(json_message, &peer_ip);
+			IPAddress replyIP(peer_ip);
+            #endif
 
-			bool as_reply = json_message.is_to_name(_from_talker.name);
+            #ifdef ENABLE_FRAME_BATCHING
+			if (_batch_window_us) {
+				#ifdef ENABLE_DIRECT_ADDRESSING
+				return _batchFrame(json_message, peer_ip);
+				#else
+				return _batchFrame(json_message, (uint32_t)broadcastIP);
+				#endif
+			}
+            #endif
+
+            #ifdef ENABLE_DIRECT_ADDRESSING
 
 			#ifdef BROADCAST_ESP_WIFI_DEBUG_NEW
 			Serial.print(F("\t\t\t\t\tsend orgn: "));
@@ -165,7 +207,7 @@ protected:
 			Serial.println(json_message.get_length());
 			#endif
 
-            if (!_udp->beginPacket(as_reply ? _from_talker.ip_address : broadcastIP, _port)) {
+            if (!_beginPacket(as_reply ? replyIP : broadcastIP)) {
                 #ifdef BROADCAST_ESP_WIFI_DEBUG
                 Serial.println(F("\tFailed to begin packet"));
                 #endif
@@ -173,21 +215,23 @@ protected:
             } else {
 				
 				#ifdef BROADCAST_ESP_WIFI_DEBUG
-				if (as_reply && _from_talker.ip_address != broadcastIP) {
+				if (as_reply && replyIP != broadcastIP) {
 
 					Serial.print(F("\tsend1: --> Directly sent to the  "));
-					Serial.print(_from_talker.ip_address);
+					Serial.print(replyIP);
 					Serial.print(F(" address --> "));
 					
 				} else {
 					
-					Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+					Serial.print(F("\tsend1: --> Broadcast sent to the "));
+					Serial.print(broadcastIP);
+					Serial.print(F(" address --> "));
 					
 				}
 				#endif
 			}
             #else
-            if (!_udp->beginPacket(broadcastIP, _port)) {
+            if (!_beginPacket(broadcastIP)) {
                 #ifdef BROADCAST_ESP_WIFI_DEBUG
                 Serial.println(F("\tFailed to begin packet"));
                 #endif
@@ -195,7 +239,9 @@ protected:
             } else {
 									
 				#ifdef BROADCAST_ESP_WIFI_DEBUG
-				Serial.print(F("\tsend1: --> Broadcast sent to the 255.255.255.255 address --> "));
+				Serial.print(F("\tsend1: --> Broadcast sent to the "));
+				Serial.print(broadcastIP);
+				Serial.print(F(" address --> "));
 				#endif
 
 			}
@@ -228,6 +274,18 @@ protected:
     }
 
 
+	#ifdef ENABLE_FRAME_BATCHING
+	bool _sendBatch(const char* datagram, size_t length, uint32_t destination) override {
+
+		if (_udp && _beginPacket(IPAddress(destination))) {
+			_udp->write(reinterpret_cast<const uint8_t*>(datagram), length);
+			return _udp->endPacket() != 0;
+		}
+		return false;
+	}
+	#endif
+
+
 public:
 
     // Move ONLY the singleton instance method to subclass
@@ -238,6 +296,18 @@ public:
 
 
     void set_port(uint16_t port) { _port = port; }
+
+    /** @brief The Talkers replied in unicast, with the hit rate of the messages sent to them by name */
+    const PeerTable& get_peers() const { return _peers; }
+
+	#ifdef ENABLE_FRAME_BATCHING
+    /**
+     * @brief Enables the batching of frames into single datagrams
+     * @param window_us The maximum time a frame waits for other frames, `0` disables batching
+     */
+	void set_batching(uint16_t window_us) { _enableBatching(_batch_sending, TALKIE_BATCH_SIZE, window_us); }
+	#endif
+
     void set_udp(WiFiUDP* udp) {
         
         // ===== [SELF IP] store local IP for self-filtering =====
@@ -245,6 +315,29 @@ public:
         _udp = udp;
     }
 
+    /**
+     * @brief Joins a multicast group, so that only the Sockets in the same group (topic) get the messages
+     * @param group_ip A multicast address, like 239.255.0.1, or 0.0.0.0 to go back to broadcast
+     * @return true if the UDP restarted in the group
+     *
+     * @note Call it after `set_udp`, it restarts the UDP in the same port. All Talkers that talk to
+     *       each other must be in the same group, given that a Socket only sends to its own group.
+     */
+    bool set_multicast(IPAddress group_ip) {
+		if (!_udp) return false;
+		_group_ip = group_ip;
+		_peers.forget();
+		_udp->stop();
+		if (!(uint32_t)_group_ip) return _udp->begin(_port);
+		#if defined(ESP8266)
+		return _udp->beginMulticast(WiFi.localIP(), _group_ip, _port);
+		#else
+		return _udp->beginMulticast(_group_ip, _port);
+		#endif
+    }
+
+    IPAddress get_multicast() const { return _group_ip; }
+
 };
 
 #endif // BROADCAST_ESP_WIFI_HPP
@@ -55,8 +55,8 @@ protected:
     };
     
 	bool _active_caller = false;
-	uint32_t _time_to_call = 0;
-	uint32_t _time_to_live = 0;
+	TalkieTimer _call_timer;	// Calls the "nano" every 60 minutes
+	TalkieTimer _led_timer;		// Turns the led off if the "nano" stops answering
     bool _is_led_on = false;	// keep track of the led state, by default it's off
 
 public:
@@ -105,10 +105,10 @@ public:
 				if (json_message.has_nth_value_number(0)) {
 					uint32_t milliseconds_to_call = json_message.get_nth_value_number(0) % 60;
 					milliseconds_to_call = (60UL - milliseconds_to_call) * 60 * 1000;
-					_time_to_call = present_time + milliseconds_to_call;
+					talker.startTimer(_call_timer, milliseconds_to_call, 60UL * 60 * 1000);
 					return true;
 				} else {
-					uint32_t minutes = (_time_to_call - present_time) / 1000 / 60;
+					uint32_t minutes = (_call_timer.get_deadline() - present_time) / 1000 / 60;
 					minutes = 59UL - minutes % 60;	// 0 based (0 to 59 minutes)
 					return json_message.set_nth_value_number(0, minutes);
 				}
@@ -127,9 +127,14 @@ public:
 
 
 	void _loop(JsonTalker& talker) override {
-		const uint32_t present_time = millis();
-		// 32 bits is 0xFFFFFFFF (4 bytes, 8 nibbles) (excludes 'negatives')
-		if (present_time - _time_to_call < 0xFFFFFFFF / 2) {
+		if (!_call_timer.is_pending()) {	// The first call is right away
+			talker.startTimer(_call_timer, 0, 60UL * 60 * 1000);	// Every 60 minutes
+		}
+	}
+
+
+	void _timer(JsonTalker& talker, TalkieTimer& timer) override {
+		if (&timer == &_call_timer) {
 			if (_active_caller) {
 				JsonMessage call_buzzer;
 				call_buzzer.set_message_value(MessageValue::TALKIE_MSG_CALL);
@@ -138,14 +143,9 @@ public:
 				call_buzzer.set_action_name("buzz");
 				talker.transmitToRepeater(call_buzzer);
 			}
-			// The time needs to be updated regardless of the transmission above
-			_time_to_call += 60UL * 60 * 1000;			// Add 60 minutes
-		}
-		// 32 bits is 0xFFFFFFFF (4 bytes, 8 nibbles) (excludes 'negatives')
-		if (present_time - _time_to_live < 0xFFFFFFFF / 2) {
+		} else if (&timer == &_led_timer) {
 			digitalWrite(LED_BUILTIN, LOW);
 			_is_led_on = false;
-			_time_to_live = _time_to_call + 1UL * 60 * 1000;	// Add 1 minute extra
 		}
 	}
 
@@ -157,7 +157,8 @@ public:
         (void)talker_match;	// Silence unused parameter warning
 
 		if (json_message.is_from_name("nano")) {
-			_time_to_live = _time_to_call + 1UL * 60 * 1000;		// Add 1 minute extra
+			// Until 1 minute after the next call
+			talker.startTimer(_led_timer, _call_timer.get_deadline() - millis() + 1UL * 60 * 1000);
 			digitalWrite(LED_BUILTIN, HIGH);
 			_is_led_on = true;
 		}
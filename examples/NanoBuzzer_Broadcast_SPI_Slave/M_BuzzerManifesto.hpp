@@ -28,6 +28,22 @@
 #define BUZZ_PIN 2	// External BUZZER pin
 
 
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAY BELOW ARE CORRECT!
+
+// The Action pair name and description shouldn't be greater than 40 chars
+// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
+
+// ------------- MAXIMUM SIZE RULER --------------|
+//	 "name", "123456789012345678901234567890123456"
+// Kept in flash (PROGMEM), so, only the Manifesto pointer takes RAM
+const FlashAction buzzer_actions[4] PROGMEM = {
+	{"buzz", "Buzz for a while", "-"},
+	{"ms", "Gets and sets the buzzing duration", "N"},
+	{"enable", "Enables 1sec cyclic transmission", "-"},
+	{"disable", "Disables 1sec cyclic transmission", "-"}
+};
+
+
 class M_BuzzerManifesto : public TalkerManifesto {
 public:
 
@@ -39,20 +55,6 @@ public:
 
 protected:
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
-
-	// The Action pair name and description shouldn't be greater than 40 chars
-	// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
-
-	// ------------- MAXIMUM SIZE RULER --------------|
-	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[4] = {
-		{"buzz", "Buzz for a while"},
-		{"ms", "Gets and sets the buzzing duration"},
-		{"enable", "Enables 1sec cyclic transmission"},
-		{"disable", "Disables 1sec cyclic transmission"}
-    };
-    
     uint16_t _buzz_duration_ms = 100;
 	uint16_t _buzz_start = 0;
 
@@ -62,10 +64,10 @@ protected:
 
 public:
 
-    const Action* _getActionsArray() const override { return actions; }
+    const FlashAction* _getFlashActionsArray() const override { return buzzer_actions; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(buzzer_actions)/sizeof(FlashAction); }
 
 
 	void _loop(JsonTalker& talker) override {
@@ -36,9 +36,9 @@
 
 
 const char talker_name[] = "buzzer";
-const char talker_desc[] = "I'm a buzzer that buzzes";
+const char talker_desc[] PROGMEM = "I'm a buzzer that buzzes";
 M_BuzzerManifesto talker_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &talker_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &talker_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& spi_socket = S_Broadcast_SPI_Arduino_Slave::instance();
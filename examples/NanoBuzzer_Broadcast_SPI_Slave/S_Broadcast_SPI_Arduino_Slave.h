@@ -34,6 +34,12 @@
 // #define BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_1
 // #define BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_2
 
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega328__) || defined(__AVR_ATmega168__)
+#define BROADCAST_SPI_ARDUINO_SLAVE_FRAMES 1	///< A single frame in each direction in the 2 KB of RAM of a Nano or Uno
+#else
+#define BROADCAST_SPI_ARDUINO_SLAVE_FRAMES 2	///< Frames queued in each direction (1, 2, 4...), each one takes 2 * TALKIE_BUFFER_SIZE of RAM
+#endif
+
 
 class S_Broadcast_SPI_Arduino_Slave : public BroadcastSocket {
 public:
@@ -63,14 +69,36 @@ public:
 
 protected:
 
-	static char _received_buffer[TALKIE_BUFFER_SIZE];
-	static char _sending_buffer[TALKIE_BUFFER_SIZE];
+	static_assert((BROADCAST_SPI_ARDUINO_SLAVE_FRAMES & (BROADCAST_SPI_ARDUINO_SLAVE_FRAMES - 1)) == 0,
+		"BROADCAST_SPI_ARDUINO_SLAVE_FRAMES has to be a power of 2");
+
+	// Both rings have free running heads and tails, where the head is only moved by the producer and the tail only
+	// by the consumer, so, with single byte indexes, no interrupts need to be disabled
+	static char _received_buffers[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES][TALKIE_BUFFER_SIZE];
+	volatile static uint8_t _received_lengths[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES];
+	volatile static uint8_t _received_head;		// Moved by the interrupt once a frame is fully received
+	volatile static uint8_t _received_tail;		// Moved by _receive once a frame is taken
+	static char _sending_buffers[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES][TALKIE_BUFFER_SIZE];
+	volatile static uint8_t _sending_lengths[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES];
+	volatile static uint8_t _sending_head;		// Moved by _send once a frame is queued
+	volatile static uint8_t _sending_tail;		// Moved by the interrupt once a frame is fully sent
 
     volatile static size_t _receiving_index;
-	volatile static size_t _received_length;
     volatile static size_t _sending_index;
-	volatile static size_t _sending_length;
     volatile static StatusByte _transmission_mode;
+	static S_Broadcast_SPI_Arduino_Slave* _interrupt_socket;	// Signaled by the interrupt, once constructed
+
+
+	static uint8_t _slot(uint8_t index) { return index & (BROADCAST_SPI_ARDUINO_SLAVE_FRAMES - 1); }
+	static bool _receivedEmpty() { return _received_head == _received_tail; }
+	static bool _receivedFull() { return (uint8_t)(_received_head - _received_tail) == BROADCAST_SPI_ARDUINO_SLAVE_FRAMES; }
+	static bool _sendingEmpty() { return _sending_head == _sending_tail; }
+	static bool _sendingFull() { return (uint8_t)(_sending_head - _sending_tail) == BROADCAST_SPI_ARDUINO_SLAVE_FRAMES; }
+
+	// Drops the frame being sent, if any
+	static void _dropSending() {
+		if (!_sendingEmpty()) _sending_tail++;
+	}
 
 
     // Needed for the compiler, the base class is the one being called though
@@ -96,34 +124,45 @@ protected:
             _max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
             // // Initialize devices control object (optional initial setup)
             // devices_ss_pins["initialized"] = true;
+			_interrupt_socket = this;
         }
 
 	
     void _receive() override {
 
-		if (_received_length) {
+		// Only the frames already received, the ones received meanwhile are left to the next call
+		for (uint8_t frames = (uint8_t)(_received_head - _received_tail); frames > 0; frames--) {
 
+			const uint8_t slot = _slot(_received_tail);
+			const uint8_t received_length = _received_lengths[slot];
 			JsonMessage new_message;
-			if (new_message.deserialize_buffer(_received_buffer, _received_length)) {
+			const bool deserialized = new_message.deserialize_buffer(_received_buffers[slot], received_length);
 				
-				#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_RECEIVE
+			#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_RECEIVE
+			if (deserialized) {
 				Serial.print(F("\treceive1: Received message: "));
-				Serial.write(_received_buffer, _received_length);
+				Serial.write(_received_buffers[slot], received_length);
 				Serial.println();
 				Serial.print(F("\treceive1: Received length: "));
-				Serial.println(_received_length);
-				#endif
-				
-				_received_length = 0;	// Allows the device to receive more data
-				_startTransmission(new_message);
-
-			} else {
-				_received_length = 0;	// Discards the data regardless
+				Serial.println(received_length);
 			}
+			#endif
+
+			_received_tail++;	// Allows the device to receive more data, the message is a copy
+			if (deserialized) {
+				_startTransmission(new_message);
+			}	// Otherwise discards the data regardless
 		}
     }
 
 
+	uint32_t _idleTime() const override {
+		if (!_receivedEmpty()) return 0;
+		// The SPI interrupt signals each received frame, so, no need of polling
+		return TALKIE_IDLE_MAX_MS;
+	}
+
+
     // Socket processing is always Half-Duplex because there is just one buffer to receive and other to send
     bool _send(const JsonMessage& json_message) override {
 
@@ -134,22 +173,26 @@ protected:
 		Serial.println(json_message.get_length());
 		#endif
 
+		// Only waits when all frames are still waiting for the Master to read them
 		const uint16_t start_waiting = (uint16_t)millis();
-		while (_sending_length > 0) {
+		while (_sendingFull()) {
 
-			if (_received_length || (uint16_t)millis() - start_waiting > 1 * 1000) {
+			if (_receivedFull() || (uint16_t)millis() - start_waiting > 1 * 1000) {
 
 				#ifdef BROADCAST_SPI_DEBUG
 					Serial.println(F("\t_unlockSendingBuffer: NOT available sending buffer"));
 				#endif
 
-				// If there is already a pending received message, process it
+				// If the received frames are piling up, process them
 				// Receive HAS priority over send!
 				return false;	// Start dropping
 			}
 		}
 
-		_sending_length = json_message.serialize_json(_sending_buffer, TALKIE_BUFFER_SIZE);
+		const uint8_t slot = _slot(_sending_head);
+		_sending_lengths[slot] = (uint8_t)json_message.serialize_json(_sending_buffers[slot], TALKIE_BUFFER_SIZE);
+		if (_sending_lengths[slot] == 0) return false;
+		_sending_head++;	// Only now the interrupt can send it
 			
         return true;
     }
@@ -189,7 +232,7 @@ public:
         if (c < 128 && _transmission_mode == TALKIE_SB_RECEIVE) {  // Only ASCII chars shall be transmitted as data
 
 			if (_receiving_index < TALKIE_BUFFER_SIZE) {
-				_received_buffer[_receiving_index++] = c;
+				_received_buffers[_slot(_received_head)][_receiving_index++] = c;
 			} else {
 				_transmission_mode = TALKIE_SB_NONE;
 				#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_1
@@ -203,7 +246,7 @@ public:
 
             switch (c) {
                 case TALKIE_SB_RECEIVE:
-					if (_received_length == 0) {
+					if (!_receivedFull()) {
 						_transmission_mode = TALKIE_SB_RECEIVE;
 						_receiving_index = 0;
 					} else {
@@ -214,29 +257,30 @@ public:
                     break;
                 case TALKIE_SB_SEND:
 					if (_sending_index < TALKIE_BUFFER_SIZE) {	// Safe code
-						if (_sending_index < _sending_length) {
-							SPDR = _sending_buffer[_sending_index++];
+						const uint8_t slot = _slot(_sending_tail);
+						if (!_sendingEmpty() && _sending_index < _sending_lengths[slot]) {
+							SPDR = _sending_buffers[slot][_sending_index++];
 						} else {
 							SPDR = TALKIE_SB_END;
 						}
 					} else {
-						_sending_length = 0;	// Makes sure the sending buffer is zeroed
+						_dropSending();	// Makes sure the sending frame is dropped
 						_transmission_mode = TALKIE_SB_NONE;
 						SPDR = TALKIE_SB_FULL;
 					}
                     break;
                 case TALKIE_SB_START:
 					if (_transmission_mode == TALKIE_SB_SEND) {	// First char to be sent
-						if (_sending_length == 0) {
+						if (_sendingEmpty()) {
 							_transmission_mode = TALKIE_SB_NONE;
 							SPDR = TALKIE_SB_NONE;
 							#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_2
 							Serial.println(F("\tNothing to be sent"));
 							#endif
 						} else if (_sending_index < TALKIE_BUFFER_SIZE) {	// Safe code
-							SPDR = _sending_buffer[_sending_index++];
+							SPDR = _sending_buffers[_slot(_sending_tail)][_sending_index++];
 						} else {
-							_sending_length = 0;	// Makes sure the sending buffer is zeroed
+							_dropSending();	// Makes sure the sending frame is dropped
 							_transmission_mode = TALKIE_SB_NONE;
 							SPDR = TALKIE_SB_FULL;
 						}
@@ -248,12 +292,14 @@ public:
                     break;
                 case TALKIE_SB_END:
 					if (_transmission_mode == TALKIE_SB_RECEIVE) {
-						_received_length = _receiving_index;
+						_received_lengths[_slot(_received_head)] = (uint8_t)_receiving_index;
+						_received_head++;	// Only now _receive can take it
+						if (_interrupt_socket) _interrupt_socket->_signalEvent();	// Wakes up the idle Repeater
 						#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_1
 						Serial.println(F("\tReceived message"));
 						#endif
                     } else if (_transmission_mode == TALKIE_SB_SEND) {
-                        _sending_length = 0;	// Makes sure the sending buffer is zeroed
+                        _dropSending();	// Sent, the next frame is sent to the next beacon
 						SPDR = TALKIE_SB_DONE;	// Doing it at the end makes sure everything above was actually set
 						#ifdef BROADCAST_SPI_ARDUINO_SLAVE_DEBUG_1
 						Serial.println(F("\tSent message"));
@@ -266,7 +312,7 @@ public:
                     break;
 				case TALKIE_SB_FULL:
 					_transmission_mode = TALKIE_SB_NONE;
-					_sending_length = 0;
+					_dropSending();
 					SPDR = TALKIE_SB_ACK;
                     break;
 				case TALKIE_SB_ERROR:
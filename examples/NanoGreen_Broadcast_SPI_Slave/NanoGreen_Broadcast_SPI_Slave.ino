@@ -49,14 +49,14 @@
 
 
 const char green_name[] = "green";
-const char green_desc[] = "I'm a green talker";
+const char green_desc[] PROGMEM = "I'm a green talker";
 M_GreenManifesto green_manifesto;
-JsonTalker green = JsonTalker(green_name, green_desc, &green_manifesto);
+JsonTalker green = JsonTalker(green_name, FPSTR(green_desc), &green_manifesto);
 
 const char yellow_name[] = "yellow";
-const char yellow_desc[] = "I'm a yellow talker";
+const char yellow_desc[] PROGMEM = "I'm a yellow talker";
 M_LedManifesto yellow_manifesto(YELLOW_LED_PIN);
-JsonTalker yellow = JsonTalker(yellow_name, yellow_desc, &yellow_manifesto);
+JsonTalker yellow = JsonTalker(yellow_name, FPSTR(yellow_desc), &yellow_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& spi_socket = S_Broadcast_SPI_Arduino_Slave::instance();
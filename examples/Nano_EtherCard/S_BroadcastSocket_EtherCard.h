@@ -40,11 +40,7 @@ private:
 	// Source Talker info
     static uint8_t _source_ip[4];
 
-	struct FromTalker {
-		char name[TALKIE_NAME_LEN] = {'\0'};
-		uint8_t ip_address[4];
-	};
-	FromTalker _from_talker;
+	PeerTable _peers;	// The Talkers replied in unicast
 	#endif
 
 
@@ -108,10 +104,11 @@ protected:
 	void _showMessage(const JsonMessage& json_message) override {
 
 		if (json_message.has_from()) {
-			json_message.get_from_name(_from_talker.name);
-			memcpy(_from_talker.ip_address, _source_ip, 4);
+			uint32_t source_ip;
+			memcpy(&source_ip, _source_ip, 4);
+			_peers.learn(json_message, source_ip);
 		} else if (json_message.is_noise()) {	// Reset name keeping
-			_from_talker.name[0] = '\0';	// Resets the from talker data
+			_peers.forget();	// Resets the from talkers data
 			return;	// It came from a Socket, no need to lose more time
 		}
 	}
@@ -131,8 +128,9 @@ protected:
 		#endif
 
 		#ifdef ENABLE_DIRECT_ADDRESSING
-		if (json_message.is_to_name(_from_talker.name)) {
-			ether.sendUdp(message_buffer, message_length, _port, _from_talker.ip_address, _port);
+		uint32_t peer_ip;
+		if (_peers.find(json_message, &peer_ip)) {
+			ether.sendUdp(message_buffer, message_length, _port, reinterpret_cast<uint8_t*>(&peer_ip), _port);
 		} else {
 			ether.sendUdp(message_buffer, message_length, _port, broadcastIp, _port);
 		}
@@ -151,6 +149,11 @@ public:
         static S_BroadcastSocket_EtherCard instance(port);
         return instance;
     }
+
+	#ifdef ENABLE_DIRECT_ADDRESSING
+    /** @brief The Talkers replied in unicast, with the hit rate of the messages sent to them by name */
+    const PeerTable& get_peers() const { return _peers; }
+	#endif
 	
 };
 
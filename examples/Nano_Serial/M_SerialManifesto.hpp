@@ -25,6 +25,21 @@
 // #define GREEN_TALKER_DEBUG
 
 
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAY BELOW ARE CORRECT!
+
+// The Action pair name and description shouldn't be greater than 40 chars
+// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
+
+// ------------- MAXIMUM SIZE RULER --------------|
+//	 "name", "123456789012345678901234567890123456"
+// Kept in flash (PROGMEM), so, only the Manifesto pointer takes RAM
+const FlashAction serial_actions[3] PROGMEM = {
+	{"on", "Turns led ON", "-"},
+	{"off", "Turns led OFF", "-"},
+	{"state", "The actual state of the led", "-"}
+};
+
+
 class M_SerialManifesto : public TalkerManifesto {
 public:
 
@@ -37,27 +52,14 @@ public:
 
 protected:
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
-
-	// The Action pair name and description shouldn't be greater than 40 chars
-	// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
-
-	// ------------- MAXIMUM SIZE RULER --------------|
-	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[3] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"},
-		{"state", "The actual state of the led"}
-    };
-    
     bool _is_led_on = false;  // keep track of state yourself, by default it's off
 
 public:
     
-    const Action* _getActionsArray() const override { return actions; }
+    const FlashAction* _getFlashActionsArray() const override { return serial_actions; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(serial_actions)/sizeof(FlashAction); }
 
 
     // Index-based operations (simplified examples)
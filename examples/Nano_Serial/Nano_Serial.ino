@@ -28,9 +28,9 @@
 
 
 const char talker_name[] = "serial";
-const char talker_desc[] = "I'm a serial talker";
+const char talker_desc[] PROGMEM = "I'm a serial talker";
 M_SerialManifesto serial_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &serial_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &serial_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& serial_socket = S_SocketSerial::instance();
@@ -37,8 +37,7 @@ protected:
     // Singleton accessor
     S_SocketSerial() : BroadcastSocket() {}
 
-	JsonMessage _json_message;
-	bool _reading_serial = false;
+	FrameReader _frames;	// The bytes read but not yet taken as a frame
 
 
     void _receive() override {
@@ -47,50 +46,41 @@ protected:
 		_reference_time = millis();
 		#endif
 
-		while (Serial.available()) {
-			char c = Serial.read();
-
-			char* message_buffer = _json_message._write_buffer();
-			if (_reading_serial) {
-
-				size_t message_length = _json_message.get_length();
-				if (message_length < TALKIE_BUFFER_SIZE) {
-					if (c == '}' && message_length && message_buffer[message_length - 1] != '\\') {
-
-						_reading_serial = false;
-
-						#ifdef SOCKET_SERIAL_DEBUG_TIMING
-						Serial.print(millis() - _reference_time);
-						#endif
-
-						if (_json_message._append('}')) {
-							_startTransmission(_json_message);
-						}
-						return;
-					} else if (!_json_message._append(c)) {
-						return;
-					}
-				} else {
-					_reading_serial = false;
-					_json_message._set_length(0);	// Reset to start writing
-				}
-			} else if (c == '{') {
-				
-				_json_message._set_length(0);
-				_reading_serial = true;
+		// Reads all the available bytes in as few calls as the free space allows, instead of one by one
+		size_t available = Serial.available();
+		while (available) {
+			const size_t free_length = _frames.get_free_length();
+			const size_t read_length = Serial.readBytes(_frames.get_free_space(), available < free_length ? available : free_length);
+			if (!read_length) return;
+			available -= read_length;
+			_frames.add_length(read_length);
+			while (true) {
+				JsonMessage new_message;
+				if (!_frames.take_frame(new_message)) break;
 
 				#ifdef SOCKET_SERIAL_DEBUG_TIMING
 				Serial.print("\n");
 				Serial.print(class_description());
 				Serial.print(": ");
+				Serial.print(millis() - _reference_time);
 				#endif
 
-				_json_message._append('{');
+				_startTransmission(new_message);
 			}
 		}
     }
 
 
+	uint32_t _idleTime() const override {
+		if (Serial.available()) return 0;
+		#ifdef ESP32
+		return BroadcastSocket::_idleTime();	// Serial doesn't wake up the idle Repeater, so, it's polled
+		#else
+		return TALKIE_IDLE_MAX_MS;	// Checked again by the idle Repeater after each interrupt
+		#endif
+	}
+
+
     bool _send(const JsonMessage& json_message) override {
 
 		#ifdef SOCKET_SERIAL_DEBUG_TIMING
@@ -39,9 +39,9 @@
 
 
 const char talker_name[] = "broadcast";
-const char talker_desc[] = "I'm a broadcast talker";
+const char talker_desc[] PROGMEM = "I'm a broadcast talker";
 M_BuzzerManifesto buzzer_manifesto;
-JsonTalker talker = JsonTalker(talker_name, talker_desc, &buzzer_manifesto);
+JsonTalker talker = JsonTalker(talker_name, FPSTR(talker_desc), &buzzer_manifesto);
 
 // Singleton requires the & (to get a reference variable)
 auto& serial_socket = S_SocketSerial::instance();
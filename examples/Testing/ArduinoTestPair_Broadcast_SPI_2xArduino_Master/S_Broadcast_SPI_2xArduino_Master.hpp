@@ -110,6 +110,7 @@ protected:
 				// Enable the SS pin
 			}
             _max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+            _hub = true;  // Slaves only hear each other through the Master
         }
 
 
@@ -71,6 +71,12 @@ auto& serial_socket = S_SocketSerial::instance();
  *
  */
 const int spi_pins[] = {4, HSPI_CS, 16};
+// Uncomment to test the data ready line, GPIO 27 wired to the GPIO 22 of every Slave (open drain, so, shared),
+// then the Slave replies to a `talk` come right away and no Slave is ever beaconed while not pulling it LOW
+// #define SPI_READY_PIN 27
+#ifdef SPI_READY_PIN
+const int spi_ready_pins[] = {SPI_READY_PIN};
+#endif
 auto& spi_socket = S_Broadcast_SPI_2xESP_4MHz_Master::instance(spi_pins, sizeof(spi_pins)/sizeof(int));
 
 
@@ -116,7 +122,11 @@ void setup() {
 
 	// ================== INITIALIZE HSPI ==================
 	// Initialize SPI with HSPI pins: MOSI=13, MISO=12, SCK=14
+	#ifdef SPI_READY_PIN
+    spi_socket.begin(13, 12, 14, spi_ready_pins, 1);	// MOSI, MISO, SCK, shared data ready line
+	#else
     spi_socket.begin(13, 12, 14);	// MOSI, MISO, SCK
+	#endif
 
     // Finally, sets the blue led as always HIGH signalling this way to be a SPI Master
     digitalWrite(LED_BUILTIN, HIGH);
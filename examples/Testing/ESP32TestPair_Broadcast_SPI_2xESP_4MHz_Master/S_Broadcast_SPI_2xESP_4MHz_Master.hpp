@@ -27,6 +27,8 @@
 
 #include <BroadcastSocket.h>
 #include "driver/spi_master.h"
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
 
 
 // #define BROADCAST_SPI_DEBUG
@@ -34,7 +36,15 @@
 
 // Broadcast SPI is fire and forget, so, it is needed to give some time to the Slaves catch up with the next send from the Master
 #define broadcast_time_slot_us 500	// Gives some time to all Slaves to process the received broadcast before a next one
-#define beacon_time_slot_us 100		// Avoids too frequent beacons (used to collect data from the SPI Slaves)
+#define beacon_time_slot_us 100		// Avoids too frequent beacons (used to collect data from the SPI Slaves without a data ready line)
+#define beacon_slots 2				// Beacons queued at once, one is routed while the other is on the wire
+#define payload_time_slot_us 50		// Gives the Slave time to queue its payload again after the header was read
+
+// A beacon is a short header transfer to read the length of the Slave payload, and then a payload transfer reads just that payload
+#define spi_header_marker 0xF0		// Header transfer, answered with the header of the pending payload
+#define spi_payload_marker 0xF1		// Payload transfer, answered with the header followed by the pending payload
+#define spi_header_size 4			// The length twice and its complement twice, as a not ready Slave answers 0x80 on all bytes
+#define spi_transfer_size(length) (((length) + 3) & ~3)	// The ESP32 Slave DMA only writes whole 4 bytes words
 
 
 class S_Broadcast_SPI_2xESP_4MHz_Master : public BroadcastSocket {
@@ -55,11 +65,34 @@ protected:
 	
     const int* _spi_cs_pins;
     const uint8_t _ss_pins_count;
+	// The optional data ready lines, just one shared by all Slaves or one per SS pin, -1 for a Slave without it
+    const int* _ready_pins = nullptr;
+    uint8_t _ready_pins_count = 0;
 	const spi_host_device_t _host;
 	
 	spi_device_handle_t _spi;
 	uint8_t _tx_buffer[TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
-	uint8_t _rx_buffer[TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
+	uint8_t _header_buffer[spi_header_size] __attribute__((aligned(4))) = {0};
+	uint8_t _payload_buffer[spi_header_size + TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
+	uint8_t _rx_buffers[beacon_slots][spi_header_size + TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {{0}};
+
+	// The SS pins of a transaction, set by the SPI driver right before and after it
+	struct ChipSelect {
+		const int* pins;
+		uint8_t count;
+	};
+	ChipSelect _broadcast_select;
+	ChipSelect _beacon_selects[beacon_slots];
+	spi_transaction_t _beacons[beacon_slots];
+	uint8_t _beacon_reads[beacon_slots];	// The payload length read by each beacon, 0 for a header transfer
+	// The beacons queued and not yet routed, from the oldest one, of which the first ones may already be collected
+	uint8_t _oldest_beacon = 0;
+	uint8_t _beacons_count = 0;
+	uint8_t _beacons_collected = 0;
+	// A payload announced by a header and not yet read
+	uint8_t _read_pin_index = 0;
+	uint8_t _read_length = 0;
+	uint32_t _header_time_us = 0;
 
 	// Sends once per pin, avoids getting stuck in processing many pins
 	uint8_t _actual_pin_index = 0;	// pin 0 has always priority
@@ -74,6 +107,8 @@ protected:
 		: BroadcastSocket(), _spi_cs_pins(ss_pins), _ss_pins_count(ss_pins_count), _host(host) {
             
 		_max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+            
+		_hub = true;  // Slaves only hear each other through the Master
 	}
 
 
@@ -89,39 +124,47 @@ protected:
 			
 			// Too many SPI sends to the Slaves asking if there is something to send will overload them, so, a timeout is needed
 			// Only for just 1 pin makes sense consider a beacon delay
-			if (micros() - _last_beacon_time_us > beacon_time_slot_us) {
-
-				#ifdef BROADCAST_SPI_DEBUG_TIMING
-				_reference_time = millis();
-				#endif
-			
-				// Arms the receiving
-				size_t payload_length = receivePayload(_spi_cs_pins[_actual_pin_index]);
-				if (payload_length > 0) {
-
-					#ifdef BROADCAST_SPI_DEBUG
-						Serial.printf("[From Beacon to pin %d] Slave: 0x%02X Beacon=1 L=%d\n",
-							_spi_cs_pins[_actual_pin_index], 0b10000000 | length, length);
-						Serial.print("[From Slave] Received: ");
-						for (int i = 0; i < length; i++) {
-							Serial.print((char)_rx_buffer[i]);
-						}
-						Serial.println();
-					#endif
-					
-					// No receiving while a send is pending, so, no _json_message corruption is possible
-					JsonMessage new_message(reinterpret_cast<const char*>( _rx_buffer ), payload_length);
-					_startTransmission(new_message);
+			bool beacon_queued = false;
+			if (_beacons_count < beacon_slots && _read_length > 0) {
+
+				// No more headers until the announced payload is read
+				if (micros() - _header_time_us > payload_time_slot_us) {
+					queueBeacon(_read_pin_index, _read_length);
+					beacon_queued = true;
+					_read_length = 0;
 				}
-				_actual_pin_index = (_actual_pin_index + 1) % _ss_pins_count;
-				// Only makes sure the cycle repeats at least after the beacon_time_slot_us
-				if (_actual_pin_index == 0) {
-					_last_beacon_time_us = micros();
+			} else if (_beacons_count < beacon_slots) {
+
+				// Slaves with a data ready line are only beaconed while requesting it, right away
+				const bool beacon_slot = micros() - _last_beacon_time_us > beacon_time_slot_us;
+				for (uint8_t pin_i = 0; pin_i < _ss_pins_count; pin_i++) {
+					const uint8_t pin_index = (_actual_pin_index + pin_i) % _ss_pins_count;
+					const int ready_pin = readyPin(pin_index);
+					if (ready_pin < 0 ? beacon_slot : digitalRead(ready_pin) == LOW) {
+
+						#ifdef BROADCAST_SPI_DEBUG_TIMING
+						_reference_time = millis();
+						#endif
+
+						queueBeacon(pin_index);
+						beacon_queued = true;
+						_actual_pin_index = (pin_index + 1) % _ss_pins_count;
+						// Only makes sure the cycle repeats at least after the beacon_time_slot_us
+						if (_actual_pin_index == 0) {
+							_last_beacon_time_us = micros();
+						}
+						break;
+					}
 				}
 			}
+			// The previous beacon is routed while the one just queued is on the wire
+			if (_beacons_count > (beacon_queued ? 1 : 0)) {
+				routeBeacon();
+			}
 		}
     }
 
+
     
     // Socket processing is always Half-Duplex because there is just one buffer to receive and other to send
     bool _send(const JsonMessage& json_message) override {
@@ -150,6 +193,8 @@ protected:
 					if (micros() - _broadcast_time_us > broadcast_time_slot_us) _in_broadcast_slot = false;
 				}
 
+				collectBeacons();	// The SPI bus is needed for the broadcast
+
 				#ifdef BROADCAST_SPI_DEBUG
 				Serial.print(F("\t\t\t\t\tsend1: Sent message: "));
 				Serial.write(json_message._read_buffer(), json_message.get_length());
@@ -157,7 +202,7 @@ protected:
 				Serial.println(json_message.get_length());
 				#endif
 			
-				broadcastPayload(_spi_cs_pins, _ss_pins_count, (uint8_t)len);
+				broadcastPayload((uint8_t)len);
 				_broadcast_time_us = micros();	// send time spacing applies after the sending (avoids bursting)
 				_last_beacon_time_us = _broadcast_time_us;
 				_actual_pin_index = 0;
@@ -186,47 +231,119 @@ protected:
 	
     // Specific methods associated to ESP SPI as Master
 	
-	void broadcastPayload(const int* ss_pins, uint8_t ss_pins_count, uint8_t length) {
+	static void IRAM_ATTR selectSlaves(spi_transaction_t* transaction) {
+		const ChipSelect* chip_select = static_cast<const ChipSelect*>(transaction->user);
+		for (uint8_t ss_pin_i = 0; ss_pin_i < chip_select->count; ss_pin_i++) {
+			gpio_ll_set_level(&GPIO, (gpio_num_t)chip_select->pins[ss_pin_i], 0);
+		}
+	}
+
+	static void IRAM_ATTR releaseSlaves(spi_transaction_t* transaction) {
+		const ChipSelect* chip_select = static_cast<const ChipSelect*>(transaction->user);
+		for (uint8_t ss_pin_i = 0; ss_pin_i < chip_select->count; ss_pin_i++) {
+			gpio_ll_set_level(&GPIO, (gpio_num_t)chip_select->pins[ss_pin_i], 1);
+		}
+	}
+
+	void broadcastPayload(uint8_t length) {
 
 		if (length > TALKIE_BUFFER_SIZE) return;
 		_tx_buffer[0] = length;
 		_tx_buffer[1] = length;
-		_tx_buffer[TALKIE_BUFFER_SIZE - 1] = 0;
 		spi_transaction_t t = {};
-		t.length = TALKIE_BUFFER_SIZE * 8;	// Bytes to bits
+		t.length = spi_transfer_size(length) * 8;	// Bytes to bits, only the bytes needed
 		t.tx_buffer = _tx_buffer;
 		t.rx_buffer = nullptr;
+		t.user = &_broadcast_select;	// All SS pins at once
 
-		for (uint8_t ss_pin_i = 0; ss_pin_i < ss_pins_count; ss_pin_i++) {
-			digitalWrite(ss_pins[ss_pin_i], LOW);
-		}
 		spi_device_transmit(_spi, &t);
-		for (uint8_t ss_pin_i = 0; ss_pin_i < ss_pins_count; ss_pin_i++) {
-			digitalWrite(ss_pins[ss_pin_i], HIGH);
-		}
 		memset(_tx_buffer, 0, sizeof(_tx_buffer));  // clear sent data
 		// Border already included in the broadcast time slot
 	}
 
-	size_t receivePayload(int ss_pin) {
-		_tx_buffer[TALKIE_BUFFER_SIZE - 1] = 0xF0;	// 0xF0 is to receive
-		spi_transaction_t t = {};
-		t.length = TALKIE_BUFFER_SIZE * 8;	// Bytes to bits
-		t.tx_buffer = _tx_buffer;
-		t.rx_buffer = _rx_buffer;
-		
-		digitalWrite(ss_pin, LOW);
-		spi_device_transmit(_spi, &t);
-		digitalWrite(ss_pin, HIGH);
-
-		if (_rx_buffer[0] > 0 && _rx_buffer[0] == _rx_buffer[1]) {
-			size_t payload_length = (size_t)_rx_buffer[0];
-			_rx_buffer[0] = '{';
-			_rx_buffer[1] = '"';
-			_rx_buffer[payload_length - 1] = '}';
-			return payload_length;
+	/** @brief The data ready line of the Slave of the given pin, -1 if none */
+	int readyPin(uint8_t pin_index) const {
+		if (_ready_pins_count == 1) return _ready_pins[0];
+		if (_ready_pins_count == _ss_pins_count) return _ready_pins[pin_index];
+		return -1;
+	}
+
+	/** @brief Queues a beacon to the Slave of the given pin, a header or, with a length, a payload one, returning right away */
+	void queueBeacon(uint8_t pin_index, uint8_t read_length = 0) {
+		const uint8_t slot = (_oldest_beacon + _beacons_count) % beacon_slots;
+		_beacon_selects[slot].pins = &_spi_cs_pins[pin_index];
+		_beacon_reads[slot] = read_length;
+		_beacons[slot] = {};
+		if (read_length > 0) {
+			_beacons[slot].length = (spi_header_size + spi_transfer_size(read_length)) * 8;	// Bytes to bits
+			_beacons[slot].tx_buffer = _payload_buffer;
+		} else {
+			_beacons[slot].length = spi_header_size * 8;
+			_beacons[slot].tx_buffer = _header_buffer;
+		}
+		_beacons[slot].rx_buffer = _rx_buffers[slot];
+		_beacons[slot].user = &_beacon_selects[slot];
+		if (spi_device_queue_trans(_spi, &_beacons[slot], portMAX_DELAY) == ESP_OK) {
+			_beacons_count++;
+		}
+	}
+
+	/** @brief Waits for all queued beacons, keeping their frames to be routed later */
+	void collectBeacons() {
+		spi_transaction_t* done;
+		while (_beacons_collected < _beacons_count
+			&& spi_device_get_trans_result(_spi, &done, portMAX_DELAY) == ESP_OK) {
+			_beacons_collected++;
+		}
+	}
+
+	/** @brief Routes the frame of the oldest beacon, waiting for it if still on the wire */
+	void routeBeacon() {
+		const uint8_t slot = _oldest_beacon;
+		if (_beacons_collected) {
+			_beacons_collected--;
+		} else {
+			spi_transaction_t* done;
+			if (spi_device_get_trans_result(_spi, &done, portMAX_DELAY) != ESP_OK) return;
+		}
+		_oldest_beacon = (_oldest_beacon + 1) % beacon_slots;
+		_beacons_count--;
+
+		const uint8_t* header = _rx_buffers[slot];
+		if (header[0] > 0 && header[0] <= TALKIE_BUFFER_SIZE && header[0] == header[1]
+			&& header[2] == (uint8_t)~header[0] && header[3] == header[2]) {
+			size_t payload_length = (size_t)header[0];
+
+			if (_beacon_reads[slot] == 0) {		// A header, the payload is read by the next beacon
+				if (_read_length == 0) {		// Otherwise the Slave keeps it for the next cycle
+					_read_pin_index = (uint8_t)(_beacon_selects[slot].pins - _spi_cs_pins);
+					_read_length = (uint8_t)payload_length;
+					_header_time_us = micros();
+				}
+				return;
+			}
+			uint8_t* rx_buffer = _rx_buffers[slot] + spi_header_size;
+			// Not the payload announced by the header
+			if (payload_length != _beacon_reads[slot] || rx_buffer[0] != header[0] || rx_buffer[1] != header[0]) return;
+
+			rx_buffer[0] = '{';
+			rx_buffer[1] = '"';
+			rx_buffer[payload_length - 1] = '}';
+
+			#ifdef BROADCAST_SPI_DEBUG
+				Serial.printf("[From Beacon to pin %d] Slave: 0x%02X Beacon=1 L=%d\n",
+					*_beacon_selects[slot].pins, (int)(0b10000000 | payload_length), (int)payload_length);
+				Serial.print("[From Slave] Received: ");
+				for (size_t i = 0; i < payload_length; i++) {
+					Serial.print((char)rx_buffer[i]);
+				}
+				Serial.println();
+			#endif
+
+			// Copied before being routed, so, the slot is free for the next beacon even if a send happens meanwhile
+			JsonMessage new_message(reinterpret_cast<const char*>( rx_buffer ), payload_length);
+			_startTransmission(new_message);
 		}
-		return 0;
 	}
 
 
@@ -240,7 +357,15 @@ public:
     }
 
 
-    void begin(int mosi_io_num, int miso_io_num, int sclk_io_num) {
+    /**
+     * @brief Starts the SPI bus as Master
+     * @param ready_pins Optional data ready lines pulled LOW by the Slaves with a payload to send, either
+     *        just one shared by all of them or one per SS pin, where -1 is for a Slave without it
+     * @param ready_pins_count 1 for a shared line, or the count of SS pins, otherwise the lines are ignored
+     *
+     * @note The Slaves without a data ready line are beaconed every `beacon_time_slot_us` instead.
+     */
+    void begin(int mosi_io_num, int miso_io_num, int sclk_io_num, const int* ready_pins = nullptr, uint8_t ready_pins_count = 0) {
 		
 		// ================== CONFIGURE SS PINS ==================
 		// CRITICAL: Configure all SS pins as outputs and set HIGH
@@ -249,21 +374,41 @@ public:
 			digitalWrite(_spi_cs_pins[ss_pin_i], HIGH);
 		}
 
+		if (ready_pins && (ready_pins_count == 1 || ready_pins_count == _ss_pins_count)) {
+			_ready_pins = ready_pins;
+			_ready_pins_count = ready_pins_count;
+			for (uint8_t ready_pin_i = 0; ready_pin_i < _ready_pins_count; ready_pin_i++) {
+				if (_ready_pins[ready_pin_i] >= 0) {
+					pinMode(_ready_pins[ready_pin_i], INPUT_PULLUP);	// The Slaves only pull it LOW (open drain)
+				}
+			}
+		}
+
 		spi_bus_config_t buscfg = {};
 		buscfg.mosi_io_num = mosi_io_num;
 		buscfg.miso_io_num = miso_io_num;
 		buscfg.sclk_io_num = sclk_io_num;
 		buscfg.quadwp_io_num = -1;
 		buscfg.quadhd_io_num = -1;
-		buscfg.max_transfer_sz = TALKIE_BUFFER_SIZE;
+		buscfg.max_transfer_sz = spi_header_size + TALKIE_BUFFER_SIZE;
 		
 		// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/spi_master.html
 
 		spi_device_interface_config_t devcfg = {};
 		devcfg.clock_speed_hz = 4000000;  // 4 MHz - Sweet spot!
 		devcfg.mode = 0;
-		devcfg.queue_size = 1;		// Only one queue is needed given that the payload is just 128 bytes
+		devcfg.queue_size = beacon_slots;	// A beacon is queued while the previous one is still on the wire
 		devcfg.spics_io_num = -1,  	// DISABLE hardware CS completely! (Broadcast)
+		devcfg.pre_cb = selectSlaves;	// The SS pins follow each queued transaction
+		devcfg.post_cb = releaseSlaves;
+
+		_broadcast_select = { _spi_cs_pins, _ss_pins_count };
+		for (uint8_t slot = 0; slot < beacon_slots; slot++) {
+			_beacon_selects[slot] = { _spi_cs_pins, 1 };
+		}
+		memset(_header_buffer, spi_header_marker, spi_header_size);
+		_payload_buffer[0] = spi_payload_marker;
+		_payload_buffer[1] = spi_payload_marker;
 
 		spi_bus_initialize(_host, &buscfg, SPI_DMA_CH_AUTO);
 		spi_bus_add_device(_host, &devcfg, &_spi);
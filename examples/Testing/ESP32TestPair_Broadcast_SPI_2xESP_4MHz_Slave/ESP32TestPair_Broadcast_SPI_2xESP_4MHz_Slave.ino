@@ -57,6 +57,8 @@ JsonTalker l_led = JsonTalker(l_led_name, l_led_desc, &led_manifesto);
 // SOCKETS
 // Singleton requires the & (to get a reference variable)
 auto& spi_socket = S_Broadcast_SPI_2xESP_4MHz_Slave::instance(VSPI_HOST);
+// Uncomment together with the SPI_READY_PIN of the Master sketch, GPIO 22 wired to its GPIO 27
+// #define SPI_READY_PIN 22
 
 
 // SETTING THE REPEATER
@@ -99,7 +101,11 @@ void setup() {
 
 	// ================== INITIALIZE VSPI ==================
 	// Initialize SPI with VSPI pins: MOSI=23, MISO=19, SCK=18, CS=5
+	#ifdef SPI_READY_PIN
+    spi_socket.begin(23, 19, 18, 5, SPI_READY_PIN);	// MOSI, MISO, SCK, CS, data ready line
+	#else
     spi_socket.begin(23, 19, 18, 5);	// MOSI, MISO, SCK, CS
+	#endif
 	spi_socket.bridgeSocket();	// Makes sure it accepts LOCAL messages too
 
     // Finally, sets the blue led as always LOW signalling this way to be a SPI Slave
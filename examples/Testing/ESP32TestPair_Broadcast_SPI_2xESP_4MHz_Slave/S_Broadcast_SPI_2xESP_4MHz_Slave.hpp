@@ -29,11 +29,19 @@
 extern "C" {
     #include "driver/spi_slave.h"
 }
+#include "hal/gpio_ll.h"
+#include "soc/gpio_struct.h"
 
 
 // #define BROADCAST_SPI_DEBUG
 // #define BROADCAST_SPI_DEBUG_TIMING
 
+// The Master polls with a short header transfer to read the length of the payload, and then reads just that payload
+#define spi_header_marker 0xF0		// Header transfer, answered with the header of the pending payload
+#define spi_payload_marker 0xF1		// Payload transfer, answered with the header followed by the pending payload
+#define spi_header_size 4			// The length twice and its complement twice, as a not ready Slave answers 0x80 on all bytes
+#define spi_transfer_size(length) (((length) + 3) & ~3)	// The ESP32 Slave DMA only writes whole 4 bytes words
+
 
 class S_Broadcast_SPI_2xESP_4MHz_Slave : public BroadcastSocket {
 public:
@@ -56,13 +64,17 @@ protected:
 	// DMA descriptors are built from the tx_buffer pointer at queue time and may be reused.
 	// Alternating the buffer address guarantees a new DMA descriptor and prevents the previous
 	// payload from being transmitted again.
-	uint8_t _tx_buffer[2][TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
-	uint8_t _rx_buffer[TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
+	uint8_t _tx_buffer[2][spi_header_size + TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
+	uint8_t _rx_buffer[spi_header_size + TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
+	// The payload waiting to be read by the Master, copied to each queued transaction until it is
+	uint8_t _payload[TALKIE_BUFFER_SIZE] __attribute__((aligned(4))) = {0};
 	// A transaction doesn't need to be aligned
 	spi_slave_transaction_t _payload_trans;
 	uint8_t _tx_index = 0;	// Better alignment afterwards
 
 	uint8_t _send_length = 0;
+	uint8_t _queued_length = 0;	// The payload length in the queued transaction
+	int _ready_io_num = -1;		// Optional data ready line, LOW while a payload is queued
 	uint8_t _stacked_transmissions = 0;
 
     // Constructor
@@ -84,19 +96,20 @@ protected:
 			}
 
 			// At this point a queued element is consumed, as to queue a new one afterwards !
-			// It's a JSON message... {"...}
-			if (_rx_buffer[TALKIE_BUFFER_SIZE - 1] == 0xF0) {
+			const size_t received_length = ret->trans_len / 8;	// Bits to bytes, the Master clocks only what is needed
+			if (_rx_buffer[0] == spi_header_marker && _rx_buffer[1] == spi_header_marker) {
+
+				// The Master just read the payload length, the payload stays queued for the following payload transfer
 
-				size_t payload_length = (size_t)_tx_buffer[_tx_index][0];
-				if (payload_length > 0) {
+			} else if (_rx_buffer[0] == spi_payload_marker && _rx_buffer[1] == spi_payload_marker) {
+
+				size_t payload_length = (size_t)_queued_length;
+				if (payload_length > 0 && received_length >= spi_header_size + payload_length) {
 
 					#ifdef BROADCAST_SPI_DEBUG
-						_tx_buffer[_tx_index][0] = '{';
-						_tx_buffer[_tx_index][1] = '"';
-						_tx_buffer[_tx_index][payload_length - 1] = '}';
 						Serial.printf("Sent %u bytes: ", payload_length);
 						for (uint8_t i = 0; i < payload_length; i++) {
-							char c = _tx_buffer[_tx_index][i];
+							char c = _payload[i];
 							if (c >= 32 && c <= 126) Serial.print(c);
 							else Serial.printf("[%02X]", c);
 						}
@@ -104,11 +117,10 @@ protected:
 					#endif
 
 					_send_length = 0;	// payload was sent
-					memset(_tx_buffer[_tx_index], 0, TALKIE_BUFFER_SIZE);  // clear entire _tx_buffer first
-					_tx_buffer[_tx_index][TALKIE_BUFFER_SIZE - 1] = _tx_index;
 				}
 
-			} else if (_rx_buffer[0] > 0 && _rx_buffer[0] == _rx_buffer[1] && _rx_buffer[0] < TALKIE_BUFFER_SIZE + 1) {
+			} else if (_rx_buffer[0] > 0 && _rx_buffer[0] == _rx_buffer[1]
+				&& _rx_buffer[0] < TALKIE_BUFFER_SIZE + 1 && _rx_buffer[0] <= received_length) {
 				
 				size_t payload_length = (size_t)_rx_buffer[0];
 				// It's a JSON data string
@@ -148,6 +160,13 @@ protected:
 		}
 	}
 
+
+	uint32_t _idleTime() const override {
+		if (!_initiated) return BroadcastSocket::_idleTime();
+		// Each finished transaction is signaled by its interrupt (transactionDone), so, no need of polling
+		return BroadcastSocket::_idleTime() > 0 ? TALKIE_IDLE_MAX_MS : 0;
+	}
+
     
     // Socket processing is always Half-Duplex because there is just one buffer to receive and other to send
     bool _send(const JsonMessage& json_message) override {
@@ -175,13 +194,14 @@ protected:
 					return false;
 				}
 			}
-			uint8_t next_tx_index = _tx_index ^ 1;
-			// Both, _tx_buffer and _send_length, set at the same time
-			char* next_tx_buffer = reinterpret_cast<char*>( _tx_buffer[next_tx_index] );
-			_send_length = (uint8_t)json_message.serialize_json(next_tx_buffer, TALKIE_BUFFER_SIZE);
-			_tx_buffer[next_tx_index][0] = _send_length;
-			_tx_buffer[next_tx_index][1] = _send_length;
-			_tx_buffer[next_tx_index][TALKIE_BUFFER_SIZE - 1] = next_tx_index;
+			// Both, _payload and _send_length, set at the same time, it goes out with the next queued transaction
+			_send_length = (uint8_t)json_message.serialize_json(reinterpret_cast<char*>( _payload ), TALKIE_BUFFER_SIZE);
+			_payload[0] = _send_length;
+			_payload[1] = _send_length;
+			if (_ready_io_num >= 0) {
+				// The queued transaction may still have a 0 length, the Master clocking it gets this payload queued next
+				digitalWrite(_ready_io_num, LOW);
+			}
 			return true;
 		}
         return false;
@@ -189,15 +209,40 @@ protected:
 
 	
     // Specific methods associated to ESP SPI as Slave
+
+	// Called by the driver interrupt once the Master finished a transaction, it releases the data ready line right
+	// after the payload was read, before the Master looks at it again, and wakes up the idle Repeater to receive it
+	static void IRAM_ATTR transactionDone(spi_slave_transaction_t* transaction) {
+		S_Broadcast_SPI_2xESP_4MHz_Slave* slave = static_cast<S_Broadcast_SPI_2xESP_4MHz_Slave*>(transaction->user);
+		const uint8_t* rx_buffer = static_cast<const uint8_t*>(transaction->rx_buffer);
+		if (slave->_ready_io_num >= 0 && rx_buffer[0] == spi_payload_marker && rx_buffer[1] == spi_payload_marker
+			&& transaction->trans_len >= (size_t)(spi_header_size + slave->_queued_length) * 8) {
+			gpio_ll_set_level(&GPIO, (gpio_num_t)slave->_ready_io_num, 1);
+		}
+		slave->_signalEvent();
+	}
 	
 	void queue_transaction() {
 		_tx_index ^= 1;	// xor, alternates in this case, 0 ^ 1 == 1 while 1 ^ 1 == 0
 		// Full-Duplex
 		spi_slave_transaction_t *t = &_payload_trans;
 		memset(t, 0, sizeof(*t));  // clear entire struct (*t is a structure, not an array)
-		t->length    = TALKIE_BUFFER_SIZE * 8;
+		// Any transfer from the Master starts with the header of the pending payload, a 0 length if none
+		_queued_length = _send_length;
+		_tx_buffer[_tx_index][0] = _queued_length;
+		_tx_buffer[_tx_index][1] = _queued_length;
+		_tx_buffer[_tx_index][2] = (uint8_t)~_queued_length;
+		_tx_buffer[_tx_index][3] = (uint8_t)~_queued_length;
+		if (_queued_length > 0) {
+			memcpy(_tx_buffer[_tx_index] + spi_header_size, _payload, spi_transfer_size(_queued_length));
+		}
+		if (_ready_io_num >= 0) {
+			digitalWrite(_ready_io_num, _queued_length > 0 ? LOW : HIGH);	// Only once the payload can be read
+		}
+		t->length    = (spi_header_size + TALKIE_BUFFER_SIZE) * 8;	// The most the Master may clock
 		t->tx_buffer = _tx_buffer[_tx_index];
 		t->rx_buffer = _rx_buffer;
+		t->user      = this;
 		// If you see 80 on the Master side it means the Slave wasn't given the time to respond!
 		spi_slave_queue_trans(_host, t, portMAX_DELAY);
 	}
@@ -213,7 +258,18 @@ public:
     }
 
 
-    void begin(int mosi_io_num, int miso_io_num, int sclk_io_num, int spics_io_num) {
+    /**
+     * @brief Starts the SPI bus as Slave
+     * @param ready_io_num Optional data ready line, pulled LOW while there is a payload for the Master to read,
+     *        that may be shared with other Slaves, given that it's open drain
+     */
+    void begin(int mosi_io_num, int miso_io_num, int sclk_io_num, int spics_io_num, int ready_io_num = -1) {
+
+		_ready_io_num = ready_io_num;
+		if (_ready_io_num >= 0) {
+			pinMode(_ready_io_num, OUTPUT_OPEN_DRAIN);
+			digitalWrite(_ready_io_num, HIGH);	// Released
+		}
 
 		// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/spi_master.html
 		
@@ -227,7 +283,7 @@ public:
 		buscfg.sclk_io_num = sclk_io_num;
 		buscfg.quadwp_io_num = -1;
 		buscfg.quadhd_io_num = -1;
-		buscfg.max_transfer_sz = TALKIE_BUFFER_SIZE;
+		buscfg.max_transfer_sz = spi_header_size + TALKIE_BUFFER_SIZE;
 		
 		
 		// Newer ESP-IDF versions have these extra fields:
@@ -240,7 +296,7 @@ public:
 		slvcfg.spics_io_num = spics_io_num;
 		slvcfg.queue_size = 1;	// It's just 128 bytes maximum, so, a queue of 1 is all it needs
 		slvcfg.post_setup_cb = nullptr;
-		slvcfg.post_trans_cb = nullptr;
+		slvcfg.post_trans_cb = transactionDone;
     
 	
 		// DMA channel must be given if > 32 bytes
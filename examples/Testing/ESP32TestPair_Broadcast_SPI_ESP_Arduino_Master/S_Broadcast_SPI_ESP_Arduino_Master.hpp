@@ -96,6 +96,8 @@ protected:
 		: BroadcastSocket(), _spi_cs_pins(ss_pins), _ss_pins_count(ss_pins_count) {
             
 		_max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+            
+		_hub = true;  // Slaves only hear each other through the Master
 	}
 
 
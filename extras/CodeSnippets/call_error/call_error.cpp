@@ -0,0 +1,168 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <JsonTalkie.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Calls the action `bpm_10` of the Talker "green", whose schema "N" takes a number, from another Talker of the same
+// MessageRepeater, first with a string as argument, refused by the schema, and then with a number. Both calls must
+// have their callback fired well before the TALKIE_CALL_TIMEOUT, the refused one with the error message and the
+// accepted one with the echo. Then the Talker "near" calls the Talker "far" of another Repeater over a wire that
+// corrupts the checksum of the request, where the checksum error sent back must have the request resent, instead of
+// ending the call, so that its callback still gets the echo. Built with the Linux host Arduino core, as in the OUTPUT below.
+
+const uint32_t ANSWER_LIMIT_US = 10000;		// Way less than the TALKIE_CALL_TIMEOUT
+
+
+// The Repeater needs a Socket, this one sends nothing anywhere
+class NullSocket : public BroadcastSocket {
+public:
+	const char* class_description() const override { return "NullSocket"; }
+	void _receive() override {}
+	bool _send(const JsonMessage&) override { return true; }
+};
+
+// One end of a wire between two Repeaters, where what one end sends is received by the other
+class WireSocket : public BroadcastSocket {
+private:
+
+	WireSocket* _other_end = nullptr;
+	std::vector<std::string> _frames;
+
+public:
+
+	const char* class_description() const override { return "WireSocket"; }
+
+	uint8_t corrupt_frames = 0;		// The next frames sent with a wrong checksum
+	uint8_t frames_sent = 0;
+
+	void connect(WireSocket& other_end) {
+		_other_end = &other_end;
+		other_end._other_end = this;
+	}
+
+	void _receive() override {
+		std::vector<std::string> frames;
+		frames.swap(_frames);
+		for (const std::string& frame : frames) {
+			JsonMessage json_message(frame.data(), frame.size());
+			_startTransmission(json_message);
+		}
+	}
+
+	bool _send(const JsonMessage& json_message) override {
+		std::string frame(json_message._read_buffer(), json_message.get_length());
+		const size_t checksum_at = frame.find("\"c\":");
+		if (corrupt_frames && checksum_at != std::string::npos) {
+			char& digit = frame[checksum_at + 4];
+			digit = digit == '9' ? '8' : digit + 1;
+			--corrupt_frames;
+		}
+		++frames_sent;
+		_other_end->_frames.push_back(frame);
+		return true;
+	}
+};
+
+class M_EmptyManifesto : public TalkerManifesto {
+public:
+	const char* class_description() const override { return "EmptyManifesto"; }
+	uint8_t _actionsCount() const override { return 0; }
+};
+
+
+NullSocket null_socket;
+M_EmptyManifesto empty_manifesto;
+M_GreenManifesto green_manifesto;
+JsonTalker caller("caller", "Calls green", &empty_manifesto);
+JsonTalker green("green", "Linux host", &green_manifesto);
+BroadcastSocket* sockets[] = { &null_socket };
+JsonTalker* talkers[] = { &caller, &green };
+MessageRepeater message_repeater(sockets, 1, talkers, 2);
+
+WireSocket near_end;
+WireSocket far_end;
+M_GreenManifesto far_manifesto;
+JsonTalker near_caller("near", "Calls far", &empty_manifesto);
+JsonTalker far_green("far", "Another board", &far_manifesto);
+BroadcastSocket* near_sockets[] = { &near_end };
+BroadcastSocket* far_sockets[] = { &far_end };
+JsonTalker* near_talkers[] = { &near_caller };
+JsonTalker* far_talkers[] = { &far_green };
+MessageRepeater near_repeater(near_sockets, 1, near_talkers, 1);
+MessageRepeater far_repeater(far_sockets, 1, far_talkers, 1);
+
+
+struct Answer {
+	const char* name;
+	bool expected_error;
+	bool answered;
+	bool error;
+	uint32_t round_trip_us;
+};
+
+
+void answered(JsonTalker&, const JsonMessage* json_message, uint32_t round_trip_us, void* context) {
+	Answer& answer = *static_cast<Answer*>(context);
+	answer.answered = json_message != nullptr;
+	answer.error = json_message && json_message->get_message_value() == MessageValue::TALKIE_MSG_ERROR;
+	answer.round_trip_us = round_trip_us;
+}
+
+
+int main() {
+
+	Answer answers[] = {
+		{ "string", true,  false, false, 0 },
+		{ "number", false, false, false, 0 }
+	};
+	JsonMessage refused;
+	refused.set_nth_value_string(0, "fast");
+	JsonMessage accepted;
+	accepted.set_nth_value_number(0, 1200);
+	if (!caller.call("green", "bpm_10", refused, answered, &answers[0])
+			|| !caller.call("green", "bpm_10", accepted, answered, &answers[1])) {
+		std::cout << "Failed to call" << std::endl;
+		return 1;
+	}
+	near_end.connect(far_end);
+	near_end.corrupt_frames = 1;	// The request
+	Answer corrupted = { "corrupted request", false, false, false, 0 };
+	if (!near_caller.call("far", "bpm_10", accepted, answered, &corrupted, TALKIE_CALL_TIMEOUT, BroadcastValue::TALKIE_BC_REMOTE)) {
+		std::cout << "Failed to call far" << std::endl;
+		return 1;
+	}
+	const unsigned long start = millis();
+	while ((caller.get_pending_calls() || near_caller.get_pending_calls()) && millis() - start < 2 * TALKIE_CALL_TIMEOUT) {
+		message_repeater.loop();
+		near_repeater.loop();
+		far_repeater.loop();
+	}
+
+	int failures = 0;
+	for (const Answer& answer : answers) {
+		const bool passed = answer.answered && answer.error == answer.expected_error && answer.round_trip_us < ANSWER_LIMIT_US;
+		if (!passed) ++failures;
+		std::cout << (passed ? "PASS " : "FAIL ") << "bpm_10 with a " << answer.name << ": "
+			<< (answer.answered ? (answer.error ? "error" : "echo") : "timeout") << " after " << answer.round_trip_us << "us" << std::endl;
+	}
+	// The request is sent once corrupted and then resent on the checksum error
+	const bool passed = corrupted.answered && !corrupted.error && near_end.frames_sent > 1;
+	if (!passed) ++failures;
+	std::cout << (passed ? "PASS " : "FAIL ") << "bpm_10 with a " << corrupted.name << ": "
+		<< (corrupted.answered ? (corrupted.error ? "error" : "echo") : "timeout") << " after " << corrupted.round_trip_us << "us"
+		<< ", requests sent=" << (int)near_end.frames_sent << std::endl;
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -O2 -I../../LinuxHost -I../../../src -I../../../manifestos call_error.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o call_error && ./call_error
+	// PASS bpm_10 with a string: error after 4us
+	// PASS bpm_10 with a number: echo after 2us
+	// PASS bpm_10 with a corrupted request: echo after 27us, requests sent=3
+
+	// Before the refused call was answered right away, its callback only fired with nullptr after the timeout:
+	// FAIL bpm_10 with a string: timeout after 1001774us
+	// And when any error ended the call, the checksum error of the corrupted request did too, instead of the echo:
+	// FAIL bpm_10 with a corrupted request: error after 19us, requests sent=2
+
+    return failures;
+}
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <poll.h>
+#include <JsonTalkie.hpp>
+#include <S_BroadcastLinux_UDP.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Linux only. Runs a MessageRepeater with many S_BroadcastLinux_UDP Sockets, one per port, receiving sparse pings
+// from a plain UDP peer in another thread, where the Repeater `idleLoop()` either polls the Sockets, as in any
+// other board, or sleeps in `epoll_wait` after `beginEpoll()`. Measures the CPU time spent by the Repeater thread
+// and the round trip of each ping up to its reply. Built with the Linux host Arduino core, as in the OUTPUT below.
+
+const int SOCKETS = 16;
+const uint16_t FIRST_PORT = 5910;
+const char* const PEER = "127.0.0.2";		// Another host in the loopback interface
+const int PINGS = 400;
+const int PING_INTERVAL_US = 5000;		// Sparse traffic, 200 pings per second over all the Sockets
+
+typedef std::chrono::steady_clock Clock;
+
+
+// The Sockets in different ports don't drop each other datagrams as self-sent, so, many can be used at once
+class PortSocket : public S_BroadcastLinux_UDP {
+public:
+	PortSocket() : S_BroadcastLinux_UDP() {}
+};
+
+
+struct Result {
+	double cpu_ms;
+	double wall_ms;
+	int replies;
+	uint32_t receive_calls;
+	std::vector<double> round_trips_us;
+};
+
+
+double threadCpuMs() {
+	timespec time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return time.tv_sec * 1000.0 + time.tv_nsec / 1e6;
+}
+
+
+// Sends each ping to a random Socket and waits for its reply, the Talker replies by all the Sockets
+void pinging(Result& result) {
+	const int enable = 1;
+	sockaddr_in peer_address = {};
+	peer_address.sin_family = AF_INET;
+	inet_pton(AF_INET, PEER, &peer_address.sin_addr);
+	const int sender = socket(AF_INET, SOCK_DGRAM, 0);
+	bind(sender, reinterpret_cast<sockaddr*>(&peer_address), sizeof(peer_address));
+	std::vector<int> listeners;
+	for (int socket_j = 0; socket_j < SOCKETS; ++socket_j) {
+		peer_address.sin_port = htons(FIRST_PORT + socket_j);
+		listeners.push_back(socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0));
+		setsockopt(listeners.back(), SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+		bind(listeners.back(), reinterpret_cast<sockaddr*>(&peer_address), sizeof(peer_address));
+	}
+
+	std::mt19937 random(1);
+	char datagram[TALKIE_BATCH_SIZE];
+	for (uint16_t ping = 1; ping <= PINGS; ++ping) {
+		std::this_thread::sleep_for(std::chrono::microseconds(PING_INTERVAL_US));
+		const int socket_j = random() % SOCKETS;
+		while (recv(listeners[socket_j], datagram, sizeof(datagram), 0) > 0) {}	// Replies by the other Sockets
+		JsonMessage request;
+		request.set_message_value(MessageValue::TALKIE_MSG_PING);
+		request.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+		request.set_from_name("peer");
+		request.set_to_name("green");
+		request.set_identity(ping);
+		request._insert_checksum();
+		sockaddr_in socket_address = {};
+		socket_address.sin_family = AF_INET;
+		socket_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		socket_address.sin_port = htons(FIRST_PORT + socket_j);
+		const Clock::time_point sent = Clock::now();
+		sendto(sender, request._read_buffer(), request.get_length(), 0, reinterpret_cast<sockaddr*>(&socket_address), sizeof(socket_address));
+		pollfd waiting = { listeners[socket_j], POLLIN, 0 };
+		if (poll(&waiting, 1, 100) == 1 && recv(listeners[socket_j], datagram, sizeof(datagram), 0) > 0) {
+			result.round_trips_us.push_back(std::chrono::duration<double, std::micro>(Clock::now() - sent).count());
+			++result.replies;
+		}
+	}
+	close(sender);
+	for (int listener : listeners) close(listener);
+}
+
+
+Result run(BroadcastSocket* const* sockets, JsonTalker* const* talkers, bool use_epoll) {
+	MessageRepeater message_repeater(sockets, SOCKETS, talkers, 1);
+	if (use_epoll && !message_repeater.beginEpoll()) std::cout << "Failed to begin epoll" << std::endl;
+	const TimingCounter& receiving = sockets[0]->get_timing(TalkieCodes::TALKIE_TM_RECEIVE);
+	const uint32_t receive_calls = receiving.samples;
+
+	Result result = { 0, 0, 0, 0, {} };
+	std::atomic<bool> pinged(false);
+	std::thread peer([&]() {
+		pinging(result);
+		pinged = true;
+	});
+	const double cpu_start = threadCpuMs();
+	const Clock::time_point start = Clock::now();
+	while (!pinged) {
+		message_repeater.idleLoop();
+	}
+	result.cpu_ms = threadCpuMs() - cpu_start;
+	result.wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	result.receive_calls = receiving.samples - receive_calls;
+	peer.join();
+	std::sort(result.round_trips_us.begin(), result.round_trips_us.end());
+	return result;
+}
+
+
+int main() {
+
+	static PortSocket port_sockets[SOCKETS];
+	BroadcastSocket* sockets[SOCKETS];
+	for (int socket_j = 0; socket_j < SOCKETS; ++socket_j) {
+		port_sockets[socket_j].set_port(FIRST_PORT + socket_j);
+		port_sockets[socket_j].set_broadcast("127.255.255.255");
+		if (!port_sockets[socket_j].begin()) {
+			std::cout << "Failed to open the Socket in port " << FIRST_PORT + socket_j << std::endl;
+			return 1;
+		}
+		sockets[socket_j] = &port_sockets[socket_j];
+	}
+	M_GreenManifesto green_manifesto;
+	JsonTalker green("green", "Linux host", &green_manifesto);
+	JsonTalker* talkers[] = { &green };
+
+	std::cout << SOCKETS << " Sockets, " << PINGS << " pings, one every " << PING_INTERVAL_US << "us" << std::endl;
+	for (const bool use_epoll : { false, true }) {
+		const Result result = run(sockets, talkers, use_epoll);
+		std::cout << (use_epoll ? "epoll  " : "polling") << ": cpu=" << (int)(1000.0 * result.cpu_ms / result.wall_ms) / 10.0 << "%"
+			<< " replies=" << result.replies << "/" << PINGS
+			<< " receive_calls=" << result.receive_calls << " (1st Socket)"
+			<< " round trip p50=" << result.round_trips_us[result.round_trips_us.size() / 2] << "us"
+			<< " p99=" << result.round_trips_us[result.round_trips_us.size() * 99 / 100] << "us" << std::endl;
+	}
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -O2 -I../../LinuxHost -I../../../src -I../../../sockets/Linux -I../../../manifestos epoll_repeater.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o epoll_repeater -pthread && ./epoll_repeater
+	// 16 Sockets, 400 pings, one every 5000us
+	// polling: cpu=49.4% replies=400/400 receive_calls=2762 (1st Socket) round trip p50=939.756us p99=1051.09us
+	// epoll  : cpu=0.5% replies=400/400 receive_calls=33 (1st Socket) round trip p50=12.106us p99=109.827us
+
+	// The polling Repeater spends half a core yielding between the receives of every Socket, each TALKIE_POLL_INTERVAL_MS,
+	// which is also the latency it adds. With epoll the thread sleeps and only the readable Sockets are received, the
+	// 33 receives of the 1st Socket are the pings sent to it plus the replies it hears from the other Sockets.
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <poll.h>
+#include <JsonTalkie.hpp>
+#include <S_BroadcastLinux_UDP.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Linux only. Checks in the loopback interface the groups (topics) of the S_BroadcastLinux_UDP Socket set by
+// `set_multicast`. First, which nodes receive a ping sent by a Talker through the Socket in broadcast and to each
+// group, where each node is a plain UDP socket bound to the same port, like the Sockets of different boards, that
+// either joined a group or none, like any unrelated host in the LAN. Then, which frames sent by another host the
+// Socket receives once it joined a group. Built with the Linux host Arduino core, as in the OUTPUT below.
+
+const uint16_t PORT = 5005;
+const char* const INTERFACE = "127.0.0.1";
+const char* const BROADCAST = "127.255.255.255";	// The broadcast address of the loopback interface
+
+struct Node {
+	const char* name;
+	const char* group;		// nullptr if it joined no group
+	int fd;
+};
+
+
+S_BroadcastLinux_UDP& udp_socket = S_BroadcastLinux_UDP::instance();
+M_GreenManifesto green_manifesto;
+JsonTalker green("green", "Linux host", &green_manifesto);
+BroadcastSocket* sockets[] = { &udp_socket };
+JsonTalker* talkers[] = { &green };
+MessageRepeater message_repeater(sockets, 1, talkers, 1);
+
+
+int openNode(const char* group) {
+	const int fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+	const int enable = 1;
+	const int disable = 0;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));	// All nodes share the same port
+	// Otherwise Linux gives the datagrams of a group to every socket of the port once any of them joined it,
+	// while separate boards only get the ones of the groups they joined
+	setsockopt(fd, IPPROTO_IP, IP_MULTICAST_ALL, &disable, sizeof(disable));
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_ANY);
+	address.sin_port = htons(PORT);
+	if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+		perror("bind");
+	}
+	if (group) {
+		ip_mreq membership = {};
+		inet_pton(AF_INET, group, &membership.imr_multiaddr);
+		inet_pton(AF_INET, INTERFACE, &membership.imr_interface);
+		if (setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+			perror("IP_ADD_MEMBERSHIP");
+		}
+	}
+	return fd;
+}
+
+
+// Returns the names of the nodes that received a datagram, emptying them
+std::string nodesReceiving(std::vector<Node>& nodes) {
+	std::string receivers;
+	for (Node& node : nodes) {
+		pollfd waiting = { node.fd, POLLIN, 0 };
+		if (poll(&waiting, 1, 50) > 0) {
+			receivers += receivers.empty() ? node.name : std::string(" ") + node.name;
+			char datagram[TALKIE_BATCH_SIZE];
+			while (recv(node.fd, datagram, sizeof(datagram), 0) > 0) {}
+		}
+	}
+	return receivers.empty() ? "none" : receivers;
+}
+
+
+// Sends a ping to all Talkers from the Talker behind the Socket, in the group set, or in broadcast if none
+std::string talkerPing(const char* group, std::vector<Node>& nodes) {
+	if (!udp_socket.set_multicast(group, INTERFACE)) std::cout << "Failed to join " << group << std::endl;
+	JsonMessage ping;
+	ping.set_message_value(MessageValue::TALKIE_MSG_PING);
+	ping.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+	green.transmitToRepeater(ping);
+	message_repeater.loop();	// Sends the queued datagrams
+	return nodesReceiving(nodes);
+}
+
+
+// Sends a ping frame from another host to the destination, returns true if received by the Socket
+bool hostPing(int sender, const char* destination) {
+	static uint16_t identity = 0;
+	JsonMessage ping;
+	ping.set_message_value(MessageValue::TALKIE_MSG_PING);
+	ping.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+	ping.set_from_name("host");
+	ping.set_identity(++identity);
+	ping._insert_checksum();
+	sockaddr_in address = {};
+	address.sin_family = AF_INET;
+	address.sin_port = htons(PORT);
+	inet_pton(AF_INET, destination, &address.sin_addr);
+	if (sendto(sender, ping._read_buffer(), ping.get_length(), 0, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+		perror("sendto");
+	}
+	const uint32_t messages_in = udp_socket.get_messages_in();
+	pollfd waiting = { udp_socket.get_fd(), POLLIN, 0 };
+	poll(&waiting, 1, 50);
+	message_repeater.loop();
+	return udp_socket.get_messages_in() > messages_in;
+}
+
+
+int main() {
+
+	std::vector<Node> nodes = {
+		{ "lights_1", "239.255.0.1", -1 },
+		{ "lights_2", "239.255.0.1", -1 },
+		{ "audio_1",  "239.255.0.2", -1 },
+		{ "printer",  nullptr,       -1 }	// An unrelated host
+	};
+	for (Node& node : nodes) node.fd = openNode(node.group);
+
+	udp_socket.set_port(PORT);
+	udp_socket.set_broadcast(BROADCAST);
+	if (!udp_socket.begin()) {
+		std::cout << "Failed to open the Socket" << std::endl;
+		return 1;
+	}
+	nodesReceiving(nodes);	// The noise sent by `begin`
+
+	int failures = 0;
+	const struct { const char* group; const char* expected; } sending[] = {
+		{ nullptr,       "lights_1 lights_2 audio_1 printer" },
+		{ "239.255.0.1", "lights_1 lights_2" },
+		{ "239.255.0.2", "audio_1" },
+		{ "239.255.0.3", "none" }
+	};
+	for (const auto& check : sending) {
+		const std::string receivers = talkerPing(check.group, nodes);
+		const bool passed = receivers == check.expected;
+		if (!passed) ++failures;
+		std::cout << (passed ? "PASS " : "FAIL ") << "Socket in " << (check.group ? check.group : BROADCAST) << " -> " << receivers << std::endl;
+	}
+
+	// Another host, given that the datagrams from the Socket port are dropped as self-sent
+	const int sender = socket(AF_INET, SOCK_DGRAM, 0);
+	const int enable = 1;
+	in_addr interface_address;
+	inet_pton(AF_INET, INTERFACE, &interface_address);
+	setsockopt(sender, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+	setsockopt(sender, IPPROTO_IP, IP_MULTICAST_IF, &interface_address, sizeof(interface_address));
+	setsockopt(sender, IPPROTO_IP, IP_MULTICAST_LOOP, &enable, sizeof(enable));	// Needed in the loopback
+
+	udp_socket.set_multicast("239.255.0.1", INTERFACE);
+	const struct { const char* destination; bool expected; } receiving[] = {
+		{ BROADCAST,     true },
+		{ "239.255.0.1", true },
+		{ "239.255.0.2", false }
+	};
+	for (const auto& check : receiving) {
+		const bool received = hostPing(sender, check.destination);
+		const bool passed = received == check.expected;
+		if (!passed) ++failures;
+		std::cout << (passed ? "PASS " : "FAIL ") << check.destination << " -> Socket in 239.255.0.1 "
+			<< (received ? "received" : "not received") << std::endl;
+	}
+	udp_socket.end();
+	for (Node& node : nodes) close(node.fd);
+	close(sender);
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -I../../LinuxHost -I../../../src -I../../../sockets/Linux -I../../../manifestos multicast_loopback.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o multicast_loopback && ./multicast_loopback
+	// PASS Socket in 127.255.255.255 -> lights_1 lights_2 audio_1 printer
+	// PASS Socket in 239.255.0.1 -> lights_1 lights_2
+	// PASS Socket in 239.255.0.2 -> audio_1
+	// PASS Socket in 239.255.0.3 -> none
+	// PASS 127.255.255.255 -> Socket in 239.255.0.1 received
+	// PASS 239.255.0.1 -> Socket in 239.255.0.1 received
+	// PASS 239.255.0.2 -> Socket in 239.255.0.1 not received
+
+	// In a group the Socket only reaches the Talkers of the boards that joined it, while still receiving the broadcast,
+	// so, the boards that stayed in broadcast can still be heard, but not reached, by the ones in a group.
+
+    return failures;
+}
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <pty.h>
+#include <JsonTalkie.hpp>
+#include <S_SocketLinux_Serial.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Linux only. Attaches the S_SocketLinux_Serial Socket to a pseudo-terminal pair, where the other side plays the
+// board sending pings, like a Nano attached by USB-UART, that a Talker behind a MessageRepeater replies to.
+// Measures the replies per second with the `read` calls and the CPU time of the Repeater thread, and then checks
+// that the Socket reopened by `begin` after `beginEpoll` still gets the pings. Built with the Linux host Arduino
+// core, as in the OUTPUT below.
+
+const int PINGS = 20000;
+const int IN_FLIGHT = 16;		// Pings sent by the board without reply, so, its pseudo-terminal is never full
+
+typedef std::chrono::steady_clock Clock;
+
+
+S_SocketLinux_Serial& serial_socket = S_SocketLinux_Serial::instance();
+M_GreenManifesto green_manifesto;
+JsonTalker green("green", "Linux host", &green_manifesto);
+BroadcastSocket* sockets[] = { &serial_socket };
+JsonTalker* talkers[] = { &green };
+MessageRepeater message_repeater(sockets, 1, talkers, 1);
+
+int board_fd = -1;		// The pseudo-terminal master, the board side
+uint16_t identity = 0;
+
+
+double threadCpuMs() {
+	timespec time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return time.tv_sec * 1000.0 + time.tv_nsec / 1e6;
+}
+
+
+void boardPing() {
+	JsonMessage request;
+	request.set_message_value(MessageValue::TALKIE_MSG_PING);
+	request.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+	request.set_from_name("nano");
+	request.set_to_name("green");
+	request.set_identity(++identity);	// Otherwise dropped as duplicates by the Repeater
+	request._insert_checksum();
+	if (write(board_fd, request._read_buffer(), request.get_length()) < 0) {
+		std::cout << "Failed to write the ping" << std::endl;
+	}
+}
+
+
+// Counts the replies in the bytes read by the board, each one a `{...}` frame
+int boardReplies(int timeout_ms) {
+	pollfd waiting = { board_fd, POLLIN, 0 };
+	if (poll(&waiting, 1, timeout_ms) != 1) return 0;
+	char bytes[4096];
+	const ssize_t length = read(board_fd, bytes, sizeof(bytes));
+	int replies = 0;
+	for (ssize_t byte_i = 0; byte_i < length; ++byte_i) {
+		if (bytes[byte_i] == '}') ++replies;
+	}
+	return replies;
+}
+
+
+int main() {
+
+	int host_fd;
+	char host_device[64];
+	if (openpty(&board_fd, &host_fd, host_device, nullptr, nullptr) != 0) {
+		std::cout << "Failed to open the pseudo-terminal" << std::endl;
+		return 1;
+	}
+	termios settings;
+	tcgetattr(board_fd, &settings);
+	cfmakeraw(&settings);
+	tcsetattr(board_fd, TCSANOW, &settings);
+	if (!serial_socket.begin(host_device, 921600) || !message_repeater.beginEpoll()) {
+		std::cout << "Failed to open " << host_device << std::endl;
+		return 1;
+	}
+	close(host_fd);		// The Socket has its own file descriptor
+
+	std::atomic<int> replies(0);
+	std::thread board([&]() {
+		for (int pinged = 0; pinged < PINGS || replies < pinged; ) {
+			if (pinged < PINGS && pinged - replies < IN_FLIGHT) {
+				boardPing();
+				++pinged;
+			}
+			const int received = boardReplies(pinged - replies < IN_FLIGHT && pinged < PINGS ? 0 : 100);
+			if (received == 0 && pinged == PINGS) break;	// The missing replies are lost
+			replies += received;
+		}
+	});
+	const uint32_t read_calls = serial_socket.get_read_calls();
+	const double cpu_start = threadCpuMs();
+	const Clock::time_point start = Clock::now();
+	while (replies < PINGS && Clock::now() - start < std::chrono::seconds(10)) {
+		message_repeater.idleLoop();
+	}
+	const double cpu_ms = threadCpuMs() - cpu_start;
+	const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	board.join();
+	std::cout << "pings: " << (long)(replies / seconds) << " replies/s replies=" << replies << "/" << PINGS
+		<< " read_calls=" << serial_socket.get_read_calls() - read_calls << " cpu=" << (long)cpu_ms << "ms" << std::endl;
+
+	// The reopened device gets another file descriptor first, and then the same number, that left the epoll set when closed
+	int failures = replies == PINGS ? 0 : 1;
+	for (int reopen = 0; reopen < 2; ++reopen) {
+		const int old_fd = serial_socket.get_fd();
+		serial_socket.begin(host_device, 921600);
+		boardPing();
+		int reopen_replies = 0;
+		const unsigned long waiting_start = millis();
+		while (reopen_replies == 0 && millis() - waiting_start < 100) {
+			message_repeater.idleLoop();
+			reopen_replies = boardReplies(0);
+		}
+		std::cout << (reopen_replies ? "PASS" : "FAIL") << " reopened after beginEpoll, fd " << old_fd << " -> " << serial_socket.get_fd()
+			<< ": replies=" << reopen_replies << std::endl;
+		if (!reopen_replies) ++failures;
+	}
+	serial_socket.end();
+	close(board_fd);
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -O2 -I../../LinuxHost -I../../../src -I../../../sockets/Linux -I../../../manifestos serial_pty.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o serial_pty -pthread -lutil && ./serial_pty
+	// pings: 173065 replies/s replies=20000/20000 read_calls=10506 cpu=27ms
+	// PASS reopened after beginEpoll, fd 5 -> 4: replies=1
+	// PASS reopened after beginEpoll, fd 4 -> 4: replies=1
+
+	// Each `read` takes about 2 pings at once, instead of one call per byte, and the reopened Socket is registered again
+	// in the epoll set by its `begin`, otherwise it would only be received when marked as readable, thus never.
+
+    return failures;
+}
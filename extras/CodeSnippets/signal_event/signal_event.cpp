@@ -0,0 +1,158 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <JsonTalkie.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Linux only. Checks that the MessageRepeater `idleLoop()` stays blocked while its Sockets have nothing to receive,
+// and wakes up as soon as a Socket calls `_signalEvent()`. Another thread plays the interrupt of a Socket that, like
+// the SPI slave ones, can't tell if there is data without being signaled, putting a ping in it from time to time,
+// with and without signaling it. Measures the time from each ping up to its reply, and the CPU time of the Repeater
+// thread, first waiting by yielding, as in the boards, and then in `epoll_wait` after `beginEpoll()`.
+// Built with the Linux host Arduino core, as in the OUTPUT below.
+
+const int PINGS = 200;
+const int PING_INTERVAL_US = 3000;		// Not a multiple of TALKIE_IDLE_MAX_MS
+
+typedef std::chrono::steady_clock Clock;
+
+
+class InterruptSocket : public BroadcastSocket {
+private:
+
+	JsonMessage _frame;
+	std::atomic<bool> _frame_ready{false};		// Moved by the interrupt once the frame is fully received
+	Clock::time_point _frame_time;
+
+protected:
+
+    void _receive() override {
+		if (_frame_ready.load(std::memory_order_acquire)) {
+			JsonMessage new_message(_frame);
+			_frame_ready.store(false, std::memory_order_release);
+			_startTransmission(new_message);
+		}
+	}
+
+	uint32_t _idleTime() const override {
+		// Only the signal tells that there is a frame, otherwise, it's never polled before TALKIE_IDLE_MAX_MS
+		return BroadcastSocket::_idleTime() > 0 ? TALKIE_IDLE_MAX_MS : 0;
+	}
+
+    bool _send(const JsonMessage&) override {
+		round_trips_us.push_back(std::chrono::duration<double, std::micro>(Clock::now() - _frame_time).count());
+		++replies;
+		return true;
+	}
+
+public:
+
+	const char* class_description() const override { return "InterruptSocket"; }
+
+	std::vector<double> round_trips_us;
+	std::atomic<int> replies{0};
+
+	// The interrupt, called by another thread
+	void interrupt(const JsonMessage& frame, bool signal) {
+		_frame = frame;
+		_frame_time = Clock::now();
+		_frame_ready.store(true, std::memory_order_release);
+		if (signal) _signalEvent();
+	}
+};
+
+
+InterruptSocket interrupt_socket;
+M_GreenManifesto green_manifesto;
+JsonTalker green("green", "Linux host", &green_manifesto);
+BroadcastSocket* sockets[] = { &interrupt_socket };
+JsonTalker* talkers[] = { &green };
+MessageRepeater message_repeater(sockets, 1, talkers, 1);
+uint16_t identity = 0;
+
+
+double threadCpuMs() {
+	timespec time;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+	return time.tv_sec * 1000.0 + time.tv_nsec / 1e6;
+}
+
+
+void interrupting(bool signal) {
+	for (int ping = 0; ping < PINGS; ++ping) {
+		std::this_thread::sleep_for(std::chrono::microseconds(PING_INTERVAL_US));
+		JsonMessage request;
+		request.set_message_value(MessageValue::TALKIE_MSG_PING);
+		request.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+		request.set_from_name("board");
+		request.set_to_name("green");
+		request.set_identity(++identity);	// Otherwise dropped as duplicates by the Repeater
+		request._insert_checksum();
+		const int replies = interrupt_socket.replies;
+		interrupt_socket.interrupt(request, signal);
+		const Clock::time_point sent = Clock::now();
+		while (interrupt_socket.replies == replies && Clock::now() - sent < std::chrono::milliseconds(100)) {
+			std::this_thread::yield();
+		}
+	}
+}
+
+
+// Returns the median round trip in microseconds
+double run(const char* title, bool signal) {
+	interrupt_socket.round_trips_us.clear();
+	interrupt_socket.replies = 0;
+	std::atomic<bool> interrupted(false);
+	std::thread board([&]() {
+		interrupting(signal);
+		interrupted = true;
+	});
+	const double cpu_start = threadCpuMs();
+	const Clock::time_point start = Clock::now();
+	while (!interrupted) {
+		message_repeater.idleLoop();
+	}
+	const double cpu_ms = threadCpuMs() - cpu_start;
+	const double wall_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	board.join();
+	std::vector<double>& round_trips = interrupt_socket.round_trips_us;
+	std::sort(round_trips.begin(), round_trips.end());
+	const double median_us = round_trips.empty() ? 1e9 : round_trips[round_trips.size() / 2];
+	std::cout << title << ": cpu=" << (int)(1000.0 * cpu_ms / wall_ms) / 10.0 << "%"
+		<< " replies=" << interrupt_socket.replies << "/" << PINGS
+		<< " round trip p50=" << (long)median_us << "us" << std::endl;
+	return median_us;
+}
+
+
+int main() {
+
+	int failures = 0;
+	// Not signaled, each ping waits for the Repeater to stop idling by itself, up to TALKIE_IDLE_MAX_MS
+	if (run("yield, not signaled", false) < 1000) ++failures;
+	if (run("yield, signaled    ", true) > 1000) ++failures;
+	if (!message_repeater.beginEpoll()) {
+		std::cout << "Failed to begin epoll" << std::endl;
+		return 1;
+	}
+	if (run("epoll, not signaled", false) < 1000) ++failures;
+	if (run("epoll, signaled    ", true) > 1000) ++failures;
+	std::cout << (failures ? "FAIL" : "PASS") << " idleLoop blocks until signaled" << std::endl;
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -O2 -I../../LinuxHost -I../../../src -I../../../manifestos signal_event.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o signal_event -pthread && ./signal_event
+	// yield, not signaled: cpu=33.1% replies=200/200 round trip p50=6943us
+	// yield, signaled    : cpu=49.2% replies=200/200 round trip p50=1us
+	// epoll, not signaled: cpu=0% replies=200/200 round trip p50=7000us
+	// epoll, signaled    : cpu=0% replies=200/200 round trip p50=2us
+	// PASS idleLoop blocks until signaled
+
+	// Without the signal the ping is only received once the Repeater stops idling by itself, each TALKIE_IDLE_MAX_MS,
+	// while the signal has it received right away. After `beginEpoll` the thread sleeps in `epoll_wait` instead of
+	// yielding, woken up by the `eventfd` written by `_wakeUp`.
+
+    return failures;
+}
@@ -0,0 +1,317 @@
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <string>
+#include <cstdint>
+#include <JsonTalkie.hpp>
+
+// Simulates the flooding of a single LOCAL message by Repeaters linked through broadcast
+// segments (Sockets), where each Repeater forwards what a Socket receives to its other Sockets.
+// Each set of rules is modeled first, and then the real MessageRepeaters, with the rules as shipped,
+// are linked by in memory Sockets. Built with the Linux host Arduino core, as in the OUTPUT below.
+
+struct Rules {
+	const char* name;
+	uint8_t max_hops;		// 0 means no hop count
+	bool split_horizon;		// Doesn't repeat back to the arrival Socket
+	bool deduplication;		// Drops the messages already routed
+};
+
+struct Frame {
+	int segment;
+	int sender;
+	uint8_t hops;
+};
+
+struct Result {
+	long frames;			// Frames sent by all Sockets
+	long deliveries;		// Messages delivered to the other Repeaters Talkers
+	long duplicates;		// Deliveries beyond the first one per Repeater
+};
+
+const long FRAMES_LIMIT = 100000;	// Beyond this the flood is considered unbounded
+
+
+Result simulate(const std::vector<std::vector<int>>& segments, int repeaters, const Rules& rules) {
+	Result result = {0, 0, 0};
+	std::vector<bool> delivered(repeaters, false);
+	std::vector<bool> routed(repeaters, false);	// The deduplication table of each Repeater
+	std::deque<Frame> frames;
+
+	// Repeater 0 has the Talker that sends the message through all its Sockets
+	for (size_t segment = 0; segment < segments.size(); ++segment) {
+		for (int repeater : segments[segment]) {
+			if (repeater == 0) frames.push_back({ (int)segment, 0, rules.max_hops });
+		}
+	}
+
+	while (!frames.empty() && result.frames < FRAMES_LIMIT) {
+		Frame frame = frames.front();
+		frames.pop_front();
+		++result.frames;
+		for (int repeater : segments[frame.segment]) {
+			if (repeater == frame.sender) continue;
+			if (rules.deduplication && routed[repeater]) continue;
+			routed[repeater] = true;
+			if (repeater != 0) {	// The sender Talker doesn't receive its own message
+				++result.deliveries;
+				if (delivered[repeater]) ++result.duplicates;
+				delivered[repeater] = true;
+			}
+			if (rules.max_hops > 0) {
+				if (frame.hops == 0) continue;	// Stays local
+			}
+			for (size_t segment = 0; segment < segments.size(); ++segment) {
+				if (rules.split_horizon && (int)segment == frame.segment) continue;
+				for (int member : segments[segment]) {
+					if (member == repeater) frames.push_back({ (int)segment, repeater, (uint8_t)(frame.hops - 1) });
+				}
+			}
+		}
+	}
+	return result;
+}
+
+
+// ================== REAL REPEATERS ==================
+// Like in a sketch, the nodes are never destroyed, given that the Talkers timers stay linked in the TimerWheel
+
+struct SegmentFrame {
+	int segment;
+	const BroadcastSocket* sender;
+	std::string json;
+};
+
+std::deque<SegmentFrame> segment_frames;
+
+
+// A Socket in a broadcast segment, where what it sends is received by all the other Sockets in it
+class SegmentSocket : public BroadcastSocket {
+public:
+
+    const char* class_description() const override { return "SegmentSocket"; }
+
+	const int segment;
+
+	explicit SegmentSocket(int segment) : BroadcastSocket(), segment(segment) {}
+
+	void deliver(const std::string& json) {
+		JsonMessage new_message;
+		char* message_buffer = new_message._write_buffer(json.size());
+		if (!message_buffer) return;
+		memcpy(message_buffer, json.data(), json.size());
+		new_message._set_length(json.size());
+		_startTransmission(new_message);
+	}
+
+protected:
+
+    void _receive() override {}
+
+    bool _send(const JsonMessage& json_message) override {
+		segment_frames.push_back({ segment, this, std::string(json_message._read_buffer(), json_message.get_length()) });
+		return true;
+	}
+};
+
+
+const FlashAction hit_actions[1] PROGMEM = {
+	{"hit", "Counts the deliveries", "SS"}	// Strings that just pad the message
+};
+
+// Counts the times the flooded call reaches its Talker
+class HitManifesto : public TalkerManifesto {
+public:
+
+    const char* class_description() const override { return "HitManifesto"; }
+
+	int hits = 0;
+
+    const FlashAction* _getFlashActionsArray() const override { return hit_actions; }
+
+    uint8_t _actionsCount() const override { return sizeof(hit_actions)/sizeof(FlashAction); }
+
+    bool _actionByIndex(uint8_t index, JsonTalker& talker, JsonMessage& json_message, TalkerMatch talker_match) override {
+		(void)index;
+		(void)talker;
+		(void)json_message;
+		(void)talker_match;
+		++hits;
+		return true;
+	}
+};
+
+
+struct RealResult {
+	long frames;
+	long deliveries;
+	long duplicates;
+	long dropped;		// Duplicates dropped by the Repeaters deduplication
+};
+
+
+// The call flooded by the Talker of the Repeater 0 to all the other Talkers, by their channel
+JsonMessage floodedCall() {
+	JsonMessage call;
+	call.set_message_value(MessageValue::TALKIE_MSG_CALL);
+	call.set_broadcast_value(BroadcastValue::TALKIE_BC_LOCAL);
+	call.set_to_channel(1);
+	call.set_action_name("hit");
+	call.set_no_reply();
+	return call;
+}
+
+
+// The same call as sent by the Repeater 0, padded to the given frame length, or empty if not possible
+JsonMessage paddedCall(size_t frame_length) {
+	const std::string padding(50, 'x');
+	for (size_t second = 0; second <= padding.size(); ++second) {
+		for (size_t first = 0; first <= padding.size(); ++first) {
+			JsonMessage call = floodedCall();
+			call.set_from_name("r0");
+			call.set_identity(12345);
+			call.set_nth_value_string(0, padding.substr(0, first).c_str());
+			if (second) call.set_nth_value_string(1, padding.substr(0, second).c_str());
+			if (call._insert_checksum() && call.get_length() == frame_length) return call;
+		}
+	}
+	return JsonMessage();
+}
+
+
+// Like in a sketch, the nodes live until the end, given that the Talkers timers stay in the TimerWheel
+// With a frame length, the Repeater 0 Socket of the first segment sends that call padded instead
+RealResult simulateReal(const std::vector<std::vector<int>>& segments, int repeaters, size_t frame_length = 0) {
+	std::vector<SegmentSocket*> sockets;
+	std::vector<HitManifesto*> manifestos;
+	std::vector<MessageRepeater*> message_repeaters;
+	JsonTalker** talkers = new JsonTalker*[repeaters];
+	for (int repeater = 0; repeater < repeaters; ++repeater) {
+		char* name = new char[TALKIE_NAME_LEN];
+		snprintf(name, TALKIE_NAME_LEN, "r%u", (unsigned)(uint8_t)repeater);	// Up to "r255", fits any name
+		manifestos.push_back(new HitManifesto());
+		talkers[repeater] = new JsonTalker(name, "Repeater Talker", manifestos.back(), 1);
+
+		BroadcastSocket** repeater_sockets = new BroadcastSocket*[segments.size()];
+		uint8_t repeater_sockets_count = 0;
+		for (size_t segment = 0; segment < segments.size(); ++segment) {
+			for (int member : segments[segment]) {
+				if (member != repeater) continue;
+				sockets.push_back(new SegmentSocket((int)segment));
+				repeater_sockets[repeater_sockets_count++] = sockets.back();
+			}
+		}
+		message_repeaters.push_back(new MessageRepeater(nullptr, 0, &talkers[repeater], 1, repeater_sockets, repeater_sockets_count));
+	}
+
+	// The Talker of the Repeater 0 calls all the other Talkers through all its Sockets, by their channel
+	if (frame_length) {
+		const JsonMessage call = paddedCall(frame_length);
+		segment_frames.push_back({ 0, sockets[0], std::string(call._read_buffer(), call.get_length()) });
+	} else {
+		JsonMessage call = floodedCall();
+		talkers[0]->transmitToRepeater(call);
+	}
+
+	RealResult result = {0, 0, 0, 0};
+	while (!segment_frames.empty() && result.frames < FRAMES_LIMIT) {
+		const SegmentFrame frame = segment_frames.front();
+		segment_frames.pop_front();
+		++result.frames;
+		for (SegmentSocket* socket : sockets) {
+			if (socket->segment == frame.segment && socket != frame.sender) socket->deliver(frame.json);
+		}
+	}
+	segment_frames.clear();
+	for (int repeater = 1; repeater < repeaters; ++repeater) {
+		result.deliveries += manifestos[repeater]->hits;
+		if (manifestos[repeater]->hits > 1) result.duplicates += manifestos[repeater]->hits - 1;
+	}
+	for (const MessageRepeater* message_repeater : message_repeaters) {
+		result.dropped += message_repeater->get_duplicates_count();
+	}
+	return result;
+}
+
+
+int main() {
+
+	// Each segment lists the Repeaters with a Socket in it
+	const std::vector<std::vector<int>> chain = { {0, 1}, {1, 2}, {2, 3}, {3, 4} };
+	const std::vector<std::vector<int>> ring = { {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0} };
+	const std::vector<std::vector<int>> mesh = { {0, 1, 2}, {1, 3}, {2, 3}, {3, 4}, {0, 4} };
+
+	const Rules rules[] = {
+		{ "none",                          0, false, false },
+		{ "hops(4)",                       4, false, false },
+		{ "hops(4) + split horizon",       4, true,  false },
+		{ "hops(4) + split horizon + dedup", 4, true, true  }
+	};
+
+	const struct { const char* name; const std::vector<std::vector<int>>* segments; } topologies[] = {
+		{ "chain", &chain }, { "ring", &ring }, { "mesh", &mesh }
+	};
+
+	int failures = 0;
+	for (const auto& topology : topologies) {
+		std::cout << "Topology: " << topology.name << std::endl;
+		for (const Rules& rule : rules) {
+			Result result = simulate(*topology.segments, 5, rule);
+			std::cout << "\t" << rule.name << ": frames=" << result.frames;
+			if (result.frames >= FRAMES_LIMIT) std::cout << " (unbounded)";
+			std::cout << " deliveries=" << result.deliveries << " duplicates=" << result.duplicates << std::endl;
+		}
+		// The shipped rules are the last ones, so, the real Repeaters shall give the same result
+		const Result model = simulate(*topology.segments, 5, rules[sizeof(rules)/sizeof(Rules) - 1]);
+		const RealResult result = simulateReal(*topology.segments, 5);
+		const bool same = result.frames == model.frames && result.deliveries == model.deliveries && result.duplicates == model.duplicates;
+		if (!same) ++failures;
+		std::cout << "\t" << (same ? "PASS" : "FAIL") << " MessageRepeater: frames=" << result.frames
+			<< " deliveries=" << result.deliveries << " duplicates=" << result.duplicates
+			<< " dropped=" << result.dropped << std::endl;
+	}
+
+	// A call near TALKIE_BUFFER_SIZE has no room to be forwarded, so, it must stay local to the first Repeater that
+	// receives it, instead of being forwarded without the hop count as a message never forwarded before
+	std::cout << "Near full call in the chain:" << std::endl;
+	for (size_t below = 1; below <= 3; ++below) {
+		const RealResult result = simulateReal(chain, 5, TALKIE_BUFFER_SIZE - below);
+		const bool local = result.frames == 1 && result.deliveries == 1;
+		if (!local) ++failures;
+		std::cout << "\t" << (local ? "PASS" : "FAIL") << " " << TALKIE_BUFFER_SIZE - below << " chars: frames=" << result.frames
+			<< " deliveries=" << result.deliveries << std::endl;
+	}
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -I../../LinuxHost -I../../../src simulate_repeaters.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o simulate_repeaters && ./simulate_repeaters
+	// Topology: chain
+	// 	none: frames=100000 (unbounded) deliveries=85233 duplicates=85229
+	// 	hops(4): frames=21 deliveries=18 duplicates=14
+	// 	hops(4) + split horizon: frames=4 deliveries=4 duplicates=0
+	// 	hops(4) + split horizon + dedup: frames=4 deliveries=4 duplicates=0
+	// 	PASS MessageRepeater: frames=4 deliveries=4 duplicates=0 dropped=0
+	// Topology: ring
+	// 	none: frames=100000 (unbounded) deliveries=79961 duplicates=79957
+	// 	hops(4): frames=62 deliveries=52 duplicates=48
+	// 	hops(4) + split horizon: frames=10 deliveries=8 duplicates=4
+	// 	hops(4) + split horizon + dedup: frames=6 deliveries=4 duplicates=0
+	// 	PASS MessageRepeater: frames=6 deliveries=4 duplicates=0 dropped=2
+	// Topology: mesh
+	// 	none: frames=100000 (unbounded) deliveries=102984 duplicates=102980
+	// 	hops(4): frames=229 deliveries=244 duplicates=240
+	// 	hops(4) + split horizon: frames=27 deliveries=28 duplicates=24
+	// 	hops(4) + split horizon + dedup: frames=7 deliveries=4 duplicates=0
+	// 	PASS MessageRepeater: frames=7 deliveries=4 duplicates=0 dropped=4
+	// Near full call in the chain:
+	// 	PASS 127 chars: frames=1 deliveries=1
+	// 	PASS 126 chars: frames=1 deliveries=1
+	// 	PASS 125 chars: frames=1 deliveries=1
+
+	// The real Repeaters, with TALKIE_MAX_HOPS, split horizon and TALKIE_DEDUP_SIZE, flood exactly as the model of the
+	// same rules, where `dropped` are the duplicates that reached a Repeater and were stopped by its deduplication.
+	// The near full call is only delivered to the Talker of the first Repeater, given that a frame with room for its
+	// checksum (',"c":N') also has room for the hop count (',"h":N'), and so, it's the checksum that no longer fits once
+	// the hop count is set, otherwise `_spendHop` keeps it local for the lack of room for the hop count.
+
+    return failures;
+}
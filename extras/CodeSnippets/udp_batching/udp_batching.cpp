@@ -0,0 +1,147 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <JsonTalkie.hpp>
+#include <S_BroadcastLinux_UDP.hpp>
+#include <M_GreenManifesto.hpp>
+
+// Linux only. Drives in the loopback interface the S_BroadcastLinux_UDP Socket, routed by a MessageRepeater to
+// a Talker, while a plain UDP peer sends it requests and counts the replies. Each burst of datagrams that reaches
+// the Socket is received by a single `recvmmsg` and all its replies go out by a single `sendmmsg`. At last, with the
+// Socket shut for writing, checks that a reply refused by `sendmmsg` is counted as failed and not as sent too.
+// Built with the Linux host Arduino core, as the command in the OUTPUT below.
+
+const uint16_t PORT = 5905;
+const char* const BROADCAST = "127.255.255.255";	// The broadcast address of the loopback interface
+const char* const PEER = "127.0.0.2";
+const int PINGS = 4096;
+
+typedef std::chrono::steady_clock Clock;
+
+
+S_BroadcastLinux_UDP& udp_socket = S_BroadcastLinux_UDP::instance();
+M_GreenManifesto green_manifesto;
+JsonTalker green("green", "Linux host", &green_manifesto);
+BroadcastSocket* sockets[] = { &udp_socket };
+JsonTalker* talkers[] = { &green };
+MessageRepeater message_repeater(sockets, 1, talkers, 1);
+
+int peer_sender = -1;
+int peer_listener = -1;
+sockaddr_in broadcast_address = {};
+uint16_t identity = 0;
+
+
+// The peer is another host in the loopback interface, so, the Socket replies to it in unicast (direct addressing)
+void openPeer() {
+	const int enable = 1;
+	sockaddr_in peer_address = {};
+	peer_address.sin_family = AF_INET;
+	inet_pton(AF_INET, PEER, &peer_address.sin_addr);
+	peer_sender = socket(AF_INET, SOCK_DGRAM, 0);	// Any other port, otherwise dropped as self-sent
+	setsockopt(peer_sender, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable));
+	bind(peer_sender, reinterpret_cast<sockaddr*>(&peer_address), sizeof(peer_address));
+	peer_address.sin_port = htons(PORT);
+	peer_listener = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+	setsockopt(peer_listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+	bind(peer_listener, reinterpret_cast<sockaddr*>(&peer_address), sizeof(peer_address));
+	broadcast_address.sin_family = AF_INET;
+	broadcast_address.sin_port = htons(PORT);
+	inet_pton(AF_INET, BROADCAST, &broadcast_address.sin_addr);
+}
+
+
+void sendRequest(MessageValue message_value) {
+	JsonMessage request;
+	request.set_message_value(message_value);
+	request.set_broadcast_value(BroadcastValue::TALKIE_BC_REMOTE);
+	request.set_from_name("peer");
+	request.set_to_name("green");
+	request.set_identity(++identity);	// Otherwise dropped as duplicates by the Repeater
+	request._insert_checksum();
+	sendto(peer_sender, request._read_buffer(), request.get_length(), 0,
+		reinterpret_cast<sockaddr*>(&broadcast_address), sizeof(broadcast_address));
+}
+
+
+// Loops the Repeater until the peer gets the expected replies from the Socket, after `beginEpoll` the
+// Socket is only received when readable, so, each receive is a `recvmmsg` that got datagrams
+int awaitReplies(int expected) {
+	int replies = 0;
+	char datagram[TALKIE_BATCH_SIZE];
+	const unsigned long start = millis();
+	while (replies < expected && millis() - start < 100) {
+		message_repeater.loop();
+		while (recv(peer_listener, datagram, sizeof(datagram), 0) > 0) ++replies;
+	}
+	return replies;
+}
+
+
+int main() {
+
+	openPeer();
+	udp_socket.set_port(PORT);
+	udp_socket.set_broadcast(BROADCAST);
+	if (!udp_socket.begin() || !message_repeater.beginEpoll()) {
+		std::cout << "Failed to open the Socket" << std::endl;
+		return 1;
+	}
+	const TimingCounter& receiving = udp_socket.get_timing(TalkieCodes::TALKIE_TM_RECEIVE);
+
+	uint32_t send_calls = udp_socket.get_send_calls();
+	uint32_t receive_calls = receiving.samples;
+	sendRequest(MessageValue::TALKIE_MSG_LIST);
+	const int actions = awaitReplies(green_manifesto._actionsCount());
+	std::cout << "list: replies=" << actions << " sendmmsg=" << udp_socket.get_send_calls() - send_calls
+		<< " recvmmsg=" << receiving.samples - receive_calls << std::endl;
+
+	for (const int burst : { 1, 16, 64 }) {
+		std::vector<double> round_trips;
+		int replies = 0;
+		send_calls = udp_socket.get_send_calls();
+		receive_calls = receiving.samples;
+		const Clock::time_point start = Clock::now();
+		for (int sent = 0; sent < PINGS; sent += burst) {
+			const Clock::time_point burst_start = Clock::now();
+			for (int ping = 0; ping < burst; ++ping) sendRequest(MessageValue::TALKIE_MSG_PING);
+			replies += awaitReplies(burst);
+			round_trips.push_back(std::chrono::duration<double, std::micro>(Clock::now() - burst_start).count());
+		}
+		const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+		std::sort(round_trips.begin(), round_trips.end());
+		std::cout << "pings in bursts of " << burst << ": " << (long)(replies / seconds) << " replies/s"
+			<< " replies=" << replies << "/" << PINGS
+			<< " sendmmsg=" << udp_socket.get_send_calls() - send_calls
+			<< " recvmmsg=" << receiving.samples - receive_calls
+			<< " burst p50=" << round_trips[round_trips.size() / 2] << "us" << std::endl;
+	}
+
+	// The reply is queued, so, counted as sent by `_timedSend`, before `sendmmsg` refuses it
+	shutdown(udp_socket.get_fd(), SHUT_WR);
+	const uint32_t messages_out = udp_socket.get_messages_out();
+	const uint16_t fails = udp_socket.get_fails_count();
+	sendRequest(MessageValue::TALKIE_MSG_PING);
+	awaitReplies(1);
+	const uint32_t sent = udp_socket.get_messages_out() - messages_out;
+	const uint16_t failed = udp_socket.get_fails_count() - fails;
+	const bool passed = sent == 0 && failed == 1;
+	std::cout << (passed ? "PASS " : "FAIL ") << "refused reply: sent=" << sent << " failed=" << failed << std::endl;
+	udp_socket.end();
+
+	// OUTPUT:
+	// $ g++ -std=c++17 -O2 -I../../LinuxHost -I../../../src -I../../../sockets/Linux -I../../../manifestos udp_batching.cpp ../../../src/JsonTalker.cpp ../../../src/BroadcastSocket.cpp -o udp_batching && ./udp_batching
+	// list: replies=5 sendmmsg=1 recvmmsg=1
+	// pings in bursts of 1: 113688 replies/s replies=4096/4096 sendmmsg=4096 recvmmsg=4096 burst p50=4.193us
+	// pings in bursts of 16: 148752 replies/s replies=4096/4096 sendmmsg=256 recvmmsg=256 burst p50=53.838us
+	// pings in bursts of 64: 149363 replies/s replies=4096/4096 sendmmsg=256 recvmmsg=256 burst p50=215.441us
+	// PASS refused reply: sent=0 failed=1
+
+	// The 5 replies of a `list` go out in a single system call, and a burst of 16 requests costs 1 system call
+	// each way instead of 16, for ~30% more replies per second in the loopback, where a system call is cheap
+	// compared to a real network interface. Bigger bursts are split in batches of BROADCAST_LINUX_UDP_VLEN.
+	// Before, the refused reply was counted both ways, as `FAIL refused reply: sent=1 failed=1`.
+
+    return passed ? 0 : 1;
+}
@@ -35,6 +35,7 @@ extern "C" {
 // Constructor
 UIPUDP::UIPUDP() :
     _uip_udp_conn(NULL),
+    _multicast(false),
     appdata()
 {
 }
@@ -56,10 +57,26 @@ UIPUDP::begin(uint16_t port)
   return 0;
 }
 
+// initialize, start listening on specified multicast group and port. Only one group at a time
+uint8_t
+UIPUDP::beginMulticast(IPAddress ip, uint16_t port)
+{
+  uip_ipaddr_t groupaddr;
+  uip_ip_addr(&groupaddr, ip);
+  uip_ipaddr_copy(uip_groupaddr, &groupaddr);
+  _multicast = true;
+  return begin(port);
+}
+
 // Finish with the UDP socket
 void
 UIPUDP::stop()
 {
+  if (_multicast)
+    {
+      uip_ipaddr(uip_groupaddr, 0, 0, 0, 0);
+      _multicast = false;
+    }
   if (_uip_udp_conn)
     {
       uip_udp_remove(_uip_udp_conn);
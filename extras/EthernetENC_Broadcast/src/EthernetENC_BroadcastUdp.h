@@ -52,6 +52,7 @@ class EthernetENC_BroadcastUDP : public UDP
 
 private:
   struct uip_udp_conn *_uip_udp_conn;
+  bool _multicast;
 
   uip_udp_userdata_t appdata;
 
@@ -59,6 +60,8 @@ public:
   EthernetENC_BroadcastUDP();  // Constructor
   uint8_t
   begin(uint16_t);// initialize, start listening on specified port. Returns 1 if successful, 0 if there are no sockets available to use
+  uint8_t
+  beginMulticast(IPAddress, uint16_t);// initialize, start listening on specified multicast group and port. Only one group at a time
   void
   stop();  // Finish with the UDP socket
 
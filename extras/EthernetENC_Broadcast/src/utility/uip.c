@@ -110,6 +110,10 @@ const uip_ipaddr_t uip_netmask =
 uip_ipaddr_t uip_hostaddr, uip_draddr, uip_netmask;
 #endif /* UIP_FIXEDADDR */
 
+/* The multicast group whose UDP packets are also received, none if
+   all zeroes. */
+uip_ipaddr_t uip_groupaddr;
+
 static const uip_ipaddr_t all_ones_addr =
 #if UIP_CONF_IPV6
   {0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff};
@@ -914,6 +918,13 @@ uip_process(u8_t flag)
 	 uip_ipchksum() == 0xffff*/) {
       goto udp_input;
     }
+    /* The same for the joined multicast group, given that the ENC28J60
+       accepts any multicast frame (ERXFCON_MCEN). */
+    if(BUF->proto == UIP_PROTO_UDP &&
+       !uip_ipaddr_cmp(uip_groupaddr, all_zeroes_addr) &&
+       uip_ipaddr_cmp(BUF->destipaddr, uip_groupaddr)) {
+      goto udp_input;
+    }
 #endif /* UIP_BROADCAST */
     
     /* Check if the packet is destined for our IP address. */
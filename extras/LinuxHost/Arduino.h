@@ -0,0 +1,197 @@
+/**
+ * @file    Arduino.h
+ * @author  Rui Seixas Monteiro
+ * @brief   The minimal Arduino core used by the library, so that it can be compiled on a Linux host
+ *          together with the `sockets/Linux` Sockets (ex. a Raspberry Pi acting as a Repeater).
+ *
+ * @see https://github.com/ruiseixasm/JsonTalkie/tree/main/extras/LinuxHost
+ *
+ * Usage (C++17 or later, `Serial` is an inline variable):
+ * ```
+ * g++ -std=c++17 -I extras/LinuxHost -I src -I sockets/Linux main.cpp src/JsonTalker.cpp src/BroadcastSocket.cpp
+ * ```
+ * - `millis()` and `micros()` wrap around like in the boards, given they come from the monotonic clock
+ * - `Serial` prints to the standard output
+ * - The pins are just kept in memory, so, `digitalRead` returns the last `digitalWrite`
+ *
+ * Created: 2026-10-18
+ */
+
+#ifndef LINUX_HOST_ARDUINO_H
+#define LINUX_HOST_ARDUINO_H
+
+#ifndef __linux__
+#error "This Arduino core replacement is only for Linux hosts"
+#endif
+#if __cplusplus < 201703L
+#error "The Linux host Arduino core requires C++17 or later"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <sched.h>
+
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef uint16_t word;
+
+
+// ================== TIME ==================
+
+inline uint64_t _host_clock_us() {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000ULL;
+}
+
+inline unsigned long millis() { return (uint32_t)(_host_clock_us() / 1000ULL); }
+inline unsigned long micros() { return (uint32_t)_host_clock_us(); }
+
+inline void delayMicroseconds(unsigned int us) {
+	const timespec pause = { (time_t)(us / 1000000U), (long)(us % 1000000U) * 1000L };
+	nanosleep(&pause, nullptr);
+}
+inline void delay(unsigned long ms) {
+	const timespec pause = { (time_t)(ms / 1000UL), (long)(ms % 1000UL) * 1000000L };
+	nanosleep(&pause, nullptr);
+}
+inline void yield() { sched_yield(); }
+
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+
+// ================== FLASH ==================
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+#define PROGMEM
+#define PSTR(string_literal) (string_literal)
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define memcpy_P memcpy
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+#define pgm_read_ptr(address) (*(void* const*)(address))
+
+
+// ================== PINS ==================
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LED_BUILTIN 13
+
+#define LINUX_HOST_PINS 64		///< Pins kept in memory, the others are ignored
+
+inline uint8_t* _host_pins() {
+	static uint8_t pins[LINUX_HOST_PINS] = {0};
+	return pins;
+}
+inline void pinMode(int pin, int mode) {
+	if (pin >= 0 && pin < LINUX_HOST_PINS && mode == INPUT_PULLUP) _host_pins()[pin] = HIGH;
+}
+inline void digitalWrite(int pin, int value) {
+	if (pin >= 0 && pin < LINUX_HOST_PINS) _host_pins()[pin] = value ? HIGH : LOW;
+}
+inline int digitalRead(int pin) {
+	return pin >= 0 && pin < LINUX_HOST_PINS ? _host_pins()[pin] : LOW;
+}
+
+
+// ================== PRINT ==================
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+protected:
+
+	size_t _printNumber(unsigned long long number, uint8_t base) {
+		char digits[8 * sizeof(number) + 1];
+		char* digit = &digits[sizeof(digits) - 1];
+		*digit = '\0';
+		if (base < 2) base = 10;
+		do {
+			const uint8_t remainder = number % base;
+			*--digit = remainder < 10 ? '0' + remainder : 'A' + remainder - 10;
+			number /= base;
+		} while (number);
+		return print(digit);
+	}
+
+	size_t _printSigned(long long number, uint8_t base) {
+		if (number < 0 && base == 10) {
+			return print('-') + _printNumber(0ULL - (unsigned long long)number, base);
+		}
+		return _printNumber((unsigned long long)number, base);
+	}
+
+public:
+
+	virtual ~Print() {}
+
+	virtual size_t write(uint8_t character) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size) {
+		size_t written = 0;
+		while (size--) written += write(*buffer++);
+		return written;
+	}
+	size_t write(const char* buffer, size_t size) { return write(reinterpret_cast<const uint8_t*>(buffer), size); }
+
+	size_t print(const char* string) { return write(string, strlen(string)); }
+	size_t print(const __FlashStringHelper* string) { return print(reinterpret_cast<const char*>(string)); }
+	size_t print(char character) { return write((uint8_t)character); }
+	size_t print(unsigned char number, int base = DEC) { return _printNumber(number, base); }
+	size_t print(int number, int base = DEC) { return _printSigned(number, base); }
+	size_t print(unsigned int number, int base = DEC) { return _printNumber(number, base); }
+	size_t print(long number, int base = DEC) { return _printSigned(number, base); }
+	size_t print(unsigned long number, int base = DEC) { return _printNumber(number, base); }
+	size_t print(long long number, int base = DEC) { return _printSigned(number, base); }
+	size_t print(unsigned long long number, int base = DEC) { return _printNumber(number, base); }
+	size_t print(double number, int digits = 2) {
+		char formatted[32];
+		const int length = snprintf(formatted, sizeof(formatted), "%.*f", digits, number);
+		return write(formatted, length > 0 ? (size_t)length : 0);
+	}
+
+	size_t println() { return write((uint8_t)'\n'); }
+	template <typename T>
+	size_t println(T value) { return print(value) + println(); }
+	template <typename T>
+	size_t println(T value, int format) { return print(value, format) + println(); }
+};
+
+
+/** @brief The `Serial` of the host is its standard output, with no input */
+class HostSerial : public Print {
+public:
+
+	using Print::write;
+	size_t write(uint8_t character) override { return fputc(character, stdout) == EOF ? 0 : 1; }
+	size_t write(const uint8_t* buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+
+	void begin(unsigned long) {}
+	void flush() { fflush(stdout); }
+	int available() { return 0; }
+	int read() { return -1; }
+	explicit operator bool() const { return true; }
+};
+
+inline HostSerial Serial;
+
+
+#endif // LINUX_HOST_ARDUINO_H
@@ -25,6 +25,20 @@
 #define BUZZ_PIN 3	// External BLACK BOX pin
 
 
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAY BELOW ARE CORRECT!
+
+// The Action pair name and description shouldn't be greater than 40 chars
+// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
+
+// ------------- MAXIMUM SIZE RULER --------------|
+//	 "name", "123456789012345678901234567890123456"
+// Kept in flash (PROGMEM), so, only the Manifesto pointer takes RAM
+const FlashAction black_actions[2] PROGMEM = {
+	{"buzz", "Buzz for a while", "-"},
+	{"ms", "Gets and sets the buzzing duration", "N"}
+};
+
+
 class M_BlackManifesto : public TalkerManifesto {
 public:
 
@@ -37,27 +51,15 @@ public:
 
 protected:
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
-
-	// The Action pair name and description shouldn't be greater than 40 chars
-	// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
-
-	// ------------- MAXIMUM SIZE RULER --------------|
-	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[2] = {
-		{"buzz", "Buzz for a while"},
-		{"ms", "Gets and sets the buzzing duration"}
-    };
-    
     uint16_t _buzz_duration_ms = 100;
 	uint16_t _buzz_start = 0;
 
 public:
 
-    const Action* _getActionsArray() const override { return actions; }
+    const FlashAction* _getFlashActionsArray() const override { return black_actions; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(black_actions)/sizeof(FlashAction); }
 
 
 	void _loop(JsonTalker& talker) override {
@@ -26,6 +26,23 @@
 // #define GREEN_TALKER_DEBUG
 
 
+// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAY BELOW ARE CORRECT!
+
+// The Action pair name and description shouldn't be greater than 40 chars
+// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
+
+// ------------- MAXIMUM SIZE RULER --------------|
+//	 "name", "123456789012345678901234567890123456"
+// Kept in flash (PROGMEM), so, only the Manifesto pointer takes RAM
+const FlashAction green_actions[5] PROGMEM = {
+	{"on", "Turns led ON", "-"},
+	{"off", "Turns led OFF", "-"},
+	{"state", "The actual state of the led", "-"},
+	{"bpm_10", "Gets/Sets the Tempo in BPM x 10", "N"},
+	{"toggle", "Toggles 'blue' led on and off", "-"}
+};
+
+
 class M_GreenManifesto : public TalkerManifesto {
 public:
 
@@ -37,21 +54,6 @@ public:
 
 protected:
 
-	// ALWAYS MAKE SURE THE DIMENSIONS OF THE ARRAYS BELOW ARE CORRECT!
-
-	// The Action pair name and description shouldn't be greater than 40 chars
-	// {"m":7,"b":1,"i":6442,"f":"","t":"","0":255,"1":"","2":"","c":25870} <-- 128 - (68 + 2*10) = 40
-
-	// ------------- MAXIMUM SIZE RULER --------------|
-	//	 "name", "123456789012345678901234567890123456"
-    const Action actions[5] = {
-		{"on", "Turns led ON"},
-		{"off", "Turns led OFF"},
-		{"state", "The actual state of the led"},
-		{"bpm_10", "Gets/Sets the Tempo in BPM x 10"},
-		{"toggle", "Toggles 'blue' led on and off"}
-    };
-    
     bool _is_led_on = false;  // keep track of state yourself, by default it's off
     uint16_t _bpm_10 = 1200;
 	uint8_t _blue_led_on = 0;
@@ -59,10 +61,10 @@ protected:
 
 public:
     
-    const Action* _getActionsArray() const override { return actions; }
+    const FlashAction* _getFlashActionsArray() const override { return green_actions; }
 
     // Size methods
-    uint8_t _actionsCount() const override { return sizeof(actions)/sizeof(Action); }
+    uint8_t _actionsCount() const override { return sizeof(green_actions)/sizeof(FlashAction); }
 
 
     // Index-based operations (simplified examples)
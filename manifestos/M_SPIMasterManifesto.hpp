@@ -60,9 +60,8 @@ protected:
 		{"ping", "Ping talkers by name or channel"}
     };
     
-	uint16_t _self_blink_time = 0;
-
-	uint32_t _last_blink = 0;
+	TalkieTimer _self_blink_timer;	// Turns the led back on 50 milliseconds after an echo
+	TalkieTimer _cyclic_timer;
 	uint8_t _yellow_led_on = 0;
 	uint32_t _cyclic_period_ms = 60;
 	bool _cyclic_transmission = true;	// true by default
@@ -115,6 +114,7 @@ public:
 			case 0:
 				if (json_message.has_nth_value_number(0)) {
 					_cyclic_period_ms = json_message.get_nth_value_number(0);
+					talker.startTimer(_cyclic_timer, _cyclic_period_ms, _cyclic_period_ms);
 				} else {
 					json_message.set_nth_value_number(0, _cyclic_period_ms);
 				}
@@ -207,25 +207,32 @@ public:
 	}
 
 
-	void _loop(JsonTalker& talker) override {
-		
-		if ((uint16_t)millis() - _self_blink_time >= 50) {	// turns off for 50 milliseconds
-			
+	uint32_t _idleTime(const JsonTalker& talker) const override {
+        (void)talker;		// Silence unused parameter warning
+		if (_burst_state == BURSTING) return 0;	// Microseconds spacing
+		return TALKIE_IDLE_MAX_MS;	// The cyclic transmission is a timer
+	}
+
+
+	void _timer(JsonTalker& talker, TalkieTimer& timer) override {
+		if (&timer == &_self_blink_timer) {
 			digitalWrite(LED_BUILTIN, HIGH);
+		} else if (&timer == &_cyclic_timer && _cyclic_transmission) {
+			if (_yellow_led_on++ % 2) {
+				_toggle_yellow_on_off.set_action_name("off");
+			} else {
+				_toggle_yellow_on_off.set_action_name("on");
+			}
+			talker.transmitToRepeater(_toggle_yellow_on_off);
+			_total_calls++;
 		}
+	}
 
-		if (millis() - _last_blink >= _cyclic_period_ms) {	// Has to be >= to avoid extra millisecond
-			_last_blink = millis();
 
-			if (_cyclic_transmission) {
-				if (_yellow_led_on++ % 2) {
-					_toggle_yellow_on_off.set_action_name("off");
-				} else {
-					_toggle_yellow_on_off.set_action_name("on");
-				}
-				talker.transmitToRepeater(_toggle_yellow_on_off);
-				_total_calls++;
-			}
+	void _loop(JsonTalker& talker) override {
+
+		if (!_cyclic_timer.is_pending()) {
+			talker.startTimer(_cyclic_timer, _cyclic_period_ms, _cyclic_period_ms);
 		}
 
 		if (_burst_toggles > 0) {
@@ -262,7 +269,7 @@ public:
 			
 			case MessageValue::TALKIE_MSG_CALL:
 				digitalWrite(LED_BUILTIN, LOW);
-				_self_blink_time = (uint16_t)millis();
+				talker.startTimer(_self_blink_timer, 50);	// turns off for 50 milliseconds
 				_total_echoes++;
 			break;
 
@@ -35,11 +35,7 @@ protected:
     uint16_t _port = 5005;
     EthernetUDP* _udp = nullptr;
 	
-	struct FromTalker {
-		char name[TALKIE_NAME_LEN] = {'\0'};
-		IPAddress ip_address;
-	};
-	FromTalker _from_talker;
+	PeerTable _peers;	// The Talkers replied in unicast
 
 
     // Constructor
@@ -88,10 +84,9 @@ protected:
 	void _showMessage(const JsonMessage& json_message) override {
 
 		if (json_message.has_from()) {
-			json_message.get_from_name(_from_talker.name);
-			_from_talker.ip_address = _udp->remoteIP();
+			_peers.learn(json_message, (uint32_t)_udp->remoteIP());
 		} else if (json_message.is_noise()) {	// Reset name keeping
-			_from_talker.name[0] = '\0';	// Resets the from talker data
+			_peers.forget();	// Resets the from talkers data
 			return;	// It came from a Socket, no need to lose more time
 		}
 	}
@@ -104,8 +99,9 @@ protected:
 			IPAddress broadcastIP(255, 255, 255, 255);
 
 			#ifdef ENABLE_DIRECT_ADDRESSING
-			if (json_message.is_to_name(_from_talker.name)) {
-				if (!_udp->beginPacket(_from_talker.ip_address, _port)) {
+			uint32_t peer_ip;
+			if (_peers.find(json_message, &peer_ip)) {
+				if (!_udp->beginPacket(IPAddress(peer_ip), _port)) {
 					#ifdef BROADCAST_ETHERNET_DEBUG
 					Serial.println(F("Failed to begin packet"));
 					#endif
@@ -164,6 +160,10 @@ public:
 
 
     void set_port(uint16_t port) { _port = port; }
+
+    /** @brief The Talkers replied in unicast, with the hit rate of the messages sent to them by name */
+    const PeerTable& get_peers() const { return _peers; }
+
     void set_udp(EthernetUDP* udp) {
 		
 		_udp = udp;
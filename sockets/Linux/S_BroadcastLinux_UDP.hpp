@@ -0,0 +1,399 @@
+/**
+ * @file    S_BroadcastLinux_UDP.hpp
+ * @author  Rui Seixas Monteiro
+ * @brief   An UDP Socket for Linux hosts (ex. a Raspberry Pi), compatible with
+ *          the `S_BroadcastESP_WiFi` and `S_EthernetENC_Broadcast` Sockets.
+ *
+ * @see https://github.com/ruiseixasm/JsonTalkie/tree/main/sockets
+ *
+ * Hardware:
+ * - Any Linux host with an IPv4 network interface
+ *
+ * The datagrams are received and sent in batches with the system calls `recvmmsg` and `sendmmsg`,
+ * so, a burst of messages, like the ones of a `list` command, costs a single system call each way.
+ *
+ * Created: 2026-10-18
+ */
+
+#ifndef BROADCAST_LINUX_UDP_HPP
+#define BROADCAST_LINUX_UDP_HPP
+
+#ifndef __linux__
+#error "The S_BroadcastLinux_UDP Socket requires Linux (recvmmsg/sendmmsg)"
+#endif
+
+
+#include <BroadcastSocket.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <unistd.h>
+#include <errno.h>
+
+
+// #define BROADCAST_LINUX_UDP_DEBUG
+
+#define ENABLE_DIRECT_ADDRESSING
+// #define ENABLE_FRAME_BATCHING	// All Sockets in the LAN must have it enabled to receive batches
+
+#if defined(ENABLE_FRAME_BATCHING) && defined(TALKIE_NO_BATCHING)
+#error "ENABLE_FRAME_BATCHING needs the batching left out by TALKIE_NO_BATCHING, in AVR boards set TALKIE_PROFILE_FULL"
+#endif
+
+#define BROADCAST_LINUX_UDP_VLEN 16			///< Datagrams per `recvmmsg` and `sendmmsg` system call
+#define BROADCAST_LINUX_UDP_LOCAL_IPS 8		///< Local IPv4 addresses kept to drop self-sent datagrams
+
+
+class S_BroadcastLinux_UDP : public BroadcastSocket {
+public:
+
+	// The Socket class description shouldn't be greater than 35 chars
+	// {"m":7,"f":"","s":3,"b":1,"t":"","i":58485,"0":1,"1":"","2":11,"c":11266} <-- 128 - (73 + 2*10) = 35
+    const char* class_description() const override { return "BroadcastLinux_UDP"; }
+
+protected:
+
+	int _fd = -1;
+	uint16_t _port = 5005;
+	in_addr_t _broadcast_ip = htonl(INADDR_BROADCAST);
+	ip_mreq _membership = {};	// The joined multicast group, none if its address is 0
+	in_addr_t _local_ips[BROADCAST_LINUX_UDP_LOCAL_IPS];
+	uint8_t _local_ips_count = 0;
+	in_addr_t _remote_ip = 0;	// The source of the datagram being processed
+
+	PeerTable _peers;	// The Talkers replied in unicast
+
+	// Each datagram slot fits a whole batch of frames
+	char _received[BROADCAST_LINUX_UDP_VLEN][TALKIE_BATCH_SIZE];
+	sockaddr_in _received_from[BROADCAST_LINUX_UDP_VLEN];
+	iovec _received_iov[BROADCAST_LINUX_UDP_VLEN];
+	mmsghdr _receiving[BROADCAST_LINUX_UDP_VLEN];
+
+	char _queued[BROADCAST_LINUX_UDP_VLEN][TALKIE_BATCH_SIZE];
+	sockaddr_in _queued_to[BROADCAST_LINUX_UDP_VLEN];
+	iovec _queued_iov[BROADCAST_LINUX_UDP_VLEN];
+	mmsghdr _sending[BROADCAST_LINUX_UDP_VLEN];
+	uint8_t _queued_frames[BROADCAST_LINUX_UDP_VLEN];	// Frames already counted as sent by each queued datagram
+	uint16_t _queued_bytes[BROADCAST_LINUX_UDP_VLEN];	// And the sum of their lengths
+	uint8_t _queued_count = 0;
+	uint32_t _send_calls = 0;
+
+	#ifdef ENABLE_FRAME_BATCHING
+	char _batch_sending[TALKIE_BATCH_SIZE];
+	#endif
+
+
+    // Constructor
+    S_BroadcastLinux_UDP() : BroadcastSocket() {}
+
+	~S_BroadcastLinux_UDP() { end(); }
+
+
+	/** @brief Keeps the IPv4 addresses of this host, the sources of the looped back broadcasts */
+	void _loadLocalIps() {
+		_local_ips_count = 0;
+		ifaddrs* interfaces = nullptr;
+		if (getifaddrs(&interfaces) != 0) return;
+		for (ifaddrs* interface = interfaces; interface && _local_ips_count < BROADCAST_LINUX_UDP_LOCAL_IPS; interface = interface->ifa_next) {
+			if (interface->ifa_addr && interface->ifa_addr->sa_family == AF_INET) {
+				_local_ips[_local_ips_count++] = reinterpret_cast<sockaddr_in*>(interface->ifa_addr)->sin_addr.s_addr;
+			}
+		}
+		freeifaddrs(interfaces);
+	}
+
+
+	bool _isSelfSent(const sockaddr_in& source) const {
+		if (source.sin_port != htons(_port)) return false;
+		for (uint8_t ip_i = 0; ip_i < _local_ips_count; ++ip_i) {
+			if (_local_ips[ip_i] == source.sin_addr.s_addr) return true;
+		}
+		return false;
+	}
+
+
+	/**
+     * @brief Queues a datagram to be sent by the next `sendmmsg`, sending the queue first if full
+     * @param frames The frames in the datagram, counted as sent once queued
+     * @param frames_bytes The sum of their lengths, without the batch envelope
+     */
+	bool _queueDatagram(const char* datagram, size_t length, in_addr_t ip_address, uint8_t frames, size_t frames_bytes) {
+		if (_fd < 0 || length > TALKIE_BATCH_SIZE) return false;
+		if (_queued_count == BROADCAST_LINUX_UDP_VLEN) _sendQueued();
+		const uint8_t slot = _queued_count++;
+		memcpy(_queued[slot], datagram, length);
+		_queued_iov[slot].iov_len = length;
+		_queued_frames[slot] = frames;
+		_queued_bytes[slot] = (uint16_t)frames_bytes;
+		_queued_to[slot].sin_addr.s_addr = ip_address;
+		_queued_to[slot].sin_port = htons(_port);
+		return true;
+	}
+
+
+	/** @brief Sends all the queued datagrams, the frames of the ones refused by the kernel are counted as fails instead of sent */
+	void _sendQueued() {
+		uint8_t sent_total = 0;
+		while (sent_total < _queued_count) {
+			const int sent = sendmmsg(_fd, &_sending[sent_total], _queued_count - sent_total, MSG_DONTWAIT);
+			++_send_calls;
+			if (sent > 0) {
+				sent_total += (uint8_t)sent;
+			} else if (sent < 0 && errno == EINTR) {
+				continue;
+			} else {
+
+				#ifdef BROADCAST_LINUX_UDP_DEBUG
+				Serial.print(F("\tsendQueued: Failed with errno "));
+				Serial.println(errno);
+				#endif
+
+				for (uint8_t slot = sent_total; slot < _queued_count; ++slot) {
+					_countUnsent(_queued_frames[slot], _queued_bytes[slot]);
+				}
+				break;
+			}
+		}
+		_queued_count = 0;
+	}
+
+
+    void _receive() override {
+
+		if (_fd < 0) return;
+
+		for (uint8_t slot = 0; slot < BROADCAST_LINUX_UDP_VLEN; ++slot) {
+			_receiving[slot].msg_hdr.msg_namelen = sizeof(sockaddr_in);	// Changed by each receive
+		}
+		const int received = recvmmsg(_fd, _receiving, BROADCAST_LINUX_UDP_VLEN, MSG_DONTWAIT, nullptr);
+		for (int slot = 0; slot < received; ++slot) {
+
+			// ===== [SELF IP] DROP self-sent packets ===== | Linux
+			if (_isSelfSent(_received_from[slot])) continue;
+			if (_receiving[slot].msg_hdr.msg_flags & MSG_TRUNC) continue;	// Bigger than a batch
+
+			const size_t length = _receiving[slot].msg_len;
+			_remote_ip = _received_from[slot].sin_addr.s_addr;
+
+			if (length && _received[slot][0] == '[') {	// A batch of frames
+				_startBatchTransmission(_received[slot], length);
+				continue;
+			}
+
+			JsonMessage new_message;
+			char* message_buffer = new_message._write_buffer(length);
+			if (!message_buffer) continue;	// Avoids overflow
+
+			memcpy(message_buffer, _received[slot], length);
+			new_message._set_length(length);
+			_startTransmission(new_message);
+		}
+    }
+
+
+	void _showMessage(const JsonMessage& json_message) override {
+
+		if (json_message.has_from()) {
+			_peers.learn(json_message, _remote_ip);
+		} else if (json_message.is_noise()) {	// Reset name keeping
+			_peers.forget();	// Resets the from talkers data
+			return;	// It came from a Socket, no need to lose more time
+		}
+	}
+
+
+    bool _send(const JsonMessage& json_message) override {
+
+		uint32_t ip_address = _membership.imr_multiaddr.s_addr ? _membership.imr_multiaddr.s_addr : _broadcast_ip;
+
+		#ifdef ENABLE_DIRECT_ADDRESSING
+		_peers.find(json_message, &ip_address);	// Otherwise stays the broadcast address
+		#endif
+
+		#ifdef ENABLE_FRAME_BATCHING
+		if (_batch_window_us) {
+			return _batchFrame(json_message, ip_address);
+		}
+		#endif
+
+		return _queueDatagram(json_message._read_buffer(), json_message.get_length(), ip_address, 1, json_message.get_length());
+    }
+
+
+	#ifdef ENABLE_FRAME_BATCHING
+	bool _sendBatch(const char* datagram, size_t length, uint32_t destination) override {
+		const uint8_t frames = datagram[0] == '[' ? _batch_frames : 1;	// A single frame goes without the batch envelope
+		return _queueDatagram(datagram, length, (in_addr_t)destination, frames, frames > 1 ? length - frames - 1 : length);
+	}
+	#endif
+
+
+public:
+
+    // Move ONLY the singleton instance method to subclass
+    static S_BroadcastLinux_UDP& instance() {
+        static S_BroadcastLinux_UDP instance;
+        return instance;
+    }
+
+
+	void _loop() override {
+		BroadcastSocket::_loop();
+		// All the replies to the received datagrams go in a single system call
+		if (_queued_count) _sendQueued();
+	}
+
+
+	uint32_t _idleTime() const override {
+		if (_queued_count) return 0;
+		return BroadcastSocket::_idleTime();
+	}
+
+
+	int _eventFd() const override { return _fd; }
+
+
+    void set_port(uint16_t port) { _port = port; }
+
+    /** @brief The Talkers replied in unicast, with the hit rate of the messages sent to them by name */
+    const PeerTable& get_peers() const { return _peers; }
+
+    /**
+     * @brief Sets the address where the broadcasted messages are sent to
+     * @param ip_address A dotted IPv4 address, like the directed broadcast `"192.168.1.255"`
+     * @return false if not a valid IPv4 address
+	 *
+     * @note The default `255.255.255.255` only goes out by the interface of the default route.
+     */
+	bool set_broadcast(const char* ip_address) {
+		in_addr address;
+		if (inet_pton(AF_INET, ip_address, &address) != 1) return false;
+		_broadcast_ip = address.s_addr;
+		return true;
+	}
+
+    /**
+     * @brief Joins a multicast group, so that only the Sockets in the same group (topic) get the messages
+     * @param group_ip A dotted multicast address, like `"239.255.0.1"`, or `nullptr` to go back to broadcast
+     * @param interface_ip The address of the interface to join and send by, the default route one if `nullptr`
+     * @return false if the socket isn't open or the group couldn't be joined
+	 *
+     * @note Call it after `begin()`, given that `end()` leaves the group.
+     */
+	bool set_multicast(const char* group_ip, const char* interface_ip = nullptr) {
+		if (_fd < 0) return false;
+		if (_membership.imr_multiaddr.s_addr) {
+			setsockopt(_fd, IPPROTO_IP, IP_DROP_MEMBERSHIP, &_membership, sizeof(_membership));
+			_membership = {};
+		}
+		_peers.forget();
+		if (!group_ip) return true;
+
+		ip_mreq membership = {};
+		const int disable = 0;
+		if (inet_pton(AF_INET, group_ip, &membership.imr_multiaddr) != 1
+			|| (interface_ip && inet_pton(AF_INET, interface_ip, &membership.imr_interface) != 1)
+			// Otherwise the groups joined by any other socket in the same port are received too
+			|| setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_ALL, &disable, sizeof(disable)) != 0
+			|| setsockopt(_fd, IPPROTO_IP, IP_MULTICAST_IF, &membership.imr_interface, sizeof(membership.imr_interface)) != 0
+			|| setsockopt(_fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+
+			#ifdef BROADCAST_LINUX_UDP_DEBUG
+			Serial.print(F("\tset_multicast: Failed with errno "));
+			Serial.println(errno);
+			#endif
+
+			return false;
+		}
+		_membership = membership;
+		return true;
+	}
+
+	#ifdef ENABLE_FRAME_BATCHING
+    /**
+     * @brief Enables the batching of frames into single datagrams
+     * @param window_us The maximum time a frame waits for other frames, `0` disables batching
+     */
+	void set_batching(uint16_t window_us) { _enableBatching(_batch_sending, TALKIE_BATCH_SIZE, window_us); }
+	#endif
+
+
+    /**
+     * @brief Opens the non blocking UDP socket bound to the set port
+     * @return false if the socket couldn't be opened or bound
+	 *
+     * @note Only one of these Sockets per host and port, given that the datagrams
+	 *       from the same host and port are dropped as being self-sent.
+     */
+	bool begin() {
+		end();
+		_fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+		if (_fd < 0) return false;
+
+		const int enable = 1;
+		sockaddr_in local_address = {};
+		local_address.sin_family = AF_INET;
+		local_address.sin_addr.s_addr = htonl(INADDR_ANY);
+		local_address.sin_port = htons(_port);
+		if (setsockopt(_fd, SOL_SOCKET, SO_BROADCAST, &enable, sizeof(enable)) != 0
+			|| setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) != 0
+			|| bind(_fd, reinterpret_cast<sockaddr*>(&local_address), sizeof(local_address)) != 0) {
+
+			#ifdef BROADCAST_LINUX_UDP_DEBUG
+			Serial.print(F("\tbegin: Failed with errno "));
+			Serial.println(errno);
+			#endif
+
+			end();
+			return false;
+		}
+		_loadLocalIps();
+		_eventFdChanged();	// Waited for by the Repeater even if opened after `beginEpoll`
+
+		// The message headers point to fixed buffers, so, they are set only once
+		for (uint8_t slot = 0; slot < BROADCAST_LINUX_UDP_VLEN; ++slot) {
+			_received_iov[slot] = { _received[slot], TALKIE_BATCH_SIZE };
+			_receiving[slot].msg_hdr = {};
+			_receiving[slot].msg_hdr.msg_name = &_received_from[slot];
+			_receiving[slot].msg_hdr.msg_iov = &_received_iov[slot];
+			_receiving[slot].msg_hdr.msg_iovlen = 1;
+			_queued_to[slot] = {};
+			_queued_to[slot].sin_family = AF_INET;
+			_queued_iov[slot] = { _queued[slot], 0 };
+			_sending[slot].msg_hdr = {};
+			_sending[slot].msg_hdr.msg_name = &_queued_to[slot];
+			_sending[slot].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			_sending[slot].msg_hdr.msg_iov = &_queued_iov[slot];
+			_sending[slot].msg_hdr.msg_iovlen = 1;
+		}
+
+		JsonMessage noise_message;
+		// No need for broadcast setting, it's for same LAN Sockets only
+		noise_message.set_message_value(MessageValue::TALKIE_MSG_NOISE);
+		// Sends noise to everybody else. Noise will trigger a reset of the kept ips on other sockets
+		_finishTransmission(noise_message);
+		return true;
+	}
+
+
+    /** @brief Closes the socket, the queued datagrams are sent first */
+	void end() {
+		if (_fd < 0) return;
+		if (_queued_count) _sendQueued();
+		close(_fd);
+		_fd = -1;
+		_membership = {};
+		_eventFdChanged();
+	}
+
+
+    /** @brief The socket file descriptor, `-1` if not open, for `poll` or `epoll` like waits */
+	int get_fd() const { return _fd; }
+
+    /** @brief The `sendmmsg` system calls done, the datagrams per call is given by `get_messages_out()` over it */
+	uint32_t get_send_calls() const { return _send_calls; }
+
+};
+
+#endif // BROADCAST_LINUX_UDP_HPP
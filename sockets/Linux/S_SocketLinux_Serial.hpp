@@ -0,0 +1,207 @@
+/**
+ * @file    S_SocketLinux_Serial.hpp
+ * @author  Rui Seixas Monteiro
+ * @brief   A Serial Socket for Linux hosts (ex. a Raspberry Pi) talking with boards attached by
+ *          an UART or USB-UART, compatible with the `{...}` framing of the `S_SocketSerial` Socket.
+ *
+ * @see https://github.com/ruiseixasm/JsonTalkie/tree/main/sockets
+ *
+ * Hardware:
+ * - Any Linux host with a serial device, like `/dev/ttyUSB0` or `/dev/ttyACM0`
+ *
+ * The device is opened non blocking in raw mode, so, each `read` takes all the bytes already
+ * received at once, and its file descriptor can be waited for with `poll` or `epoll`.
+ *
+ * Created: 2026-10-18
+ */
+
+#ifndef SOCKET_LINUX_SERIAL_HPP
+#define SOCKET_LINUX_SERIAL_HPP
+
+#ifndef __linux__
+#error "The S_SocketLinux_Serial Socket requires Linux (termios)"
+#endif
+
+
+#include <BroadcastSocket.h>
+#include <termios.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <errno.h>
+
+
+// #define SOCKET_LINUX_SERIAL_DEBUG
+
+#define SOCKET_LINUX_SERIAL_WRITE_MS 100		///< Maximum time a message waits for the device to take it
+
+
+class S_SocketLinux_Serial : public BroadcastSocket {
+public:
+
+	// The Socket class description shouldn't be greater than 35 chars
+	// {"m":7,"f":"","s":3,"b":1,"t":"","i":58485,"0":1,"1":"","2":11,"c":11266} <-- 128 - (73 + 2*10) = 35
+    const char* class_description() const override { return "SocketLinux_Serial"; }
+
+protected:
+
+	int _fd = -1;
+	FrameReader _frames;	// The bytes read but not yet taken as a frame
+	uint32_t _read_calls = 0;
+
+
+    // Constructor
+    S_SocketLinux_Serial() : BroadcastSocket() {}
+
+	~S_SocketLinux_Serial() { end(); }
+
+
+	/** @brief The termios speed of a baud rate, `B0` if not a standard one */
+	static speed_t _speed(uint32_t baud_rate) {
+		switch (baud_rate) {
+			case 9600:		return B9600;
+			case 19200:		return B19200;
+			case 38400:		return B38400;
+			case 57600:		return B57600;
+			case 115200:	return B115200;
+			case 230400:	return B230400;
+			case 460800:	return B460800;
+			case 500000:	return B500000;
+			case 921600:	return B921600;
+			case 1000000:	return B1000000;
+			case 2000000:	return B2000000;
+			case 3000000:	return B3000000;
+			case 4000000:	return B4000000;
+		}
+		return B0;
+	}
+
+
+    void _receive() override {
+
+		if (_fd < 0) return;
+
+		while (true) {
+			const size_t free_length = _frames.get_free_length();
+			const ssize_t read_length = read(_fd, _frames.get_free_space(), free_length);
+			++_read_calls;
+			if (read_length <= 0) {
+				if (read_length < 0 && errno == EINTR) continue;
+				return;		// EAGAIN, all the received bytes were taken
+			}
+			_frames.add_length((size_t)read_length);
+			while (true) {
+				JsonMessage new_message;
+				if (!_frames.take_frame(new_message)) break;
+				_startTransmission(new_message);
+			}
+			if ((size_t)read_length < free_length) return;	// Nothing else was waiting
+		}
+    }
+
+
+    bool _send(const JsonMessage& json_message) override {
+
+		if (_fd < 0) return false;
+
+		const char* message_buffer = json_message._read_buffer();
+		size_t message_length = json_message.get_length();
+		// The device buffer may be full, in which case it's waited until it takes the rest
+		while (message_length) {
+			const ssize_t written = write(_fd, message_buffer, message_length);
+			if (written > 0) {
+				message_buffer += written;
+				message_length -= (size_t)written;
+			} else if (written < 0 && errno == EINTR) {
+				continue;
+			} else if (written < 0 && errno == EAGAIN) {
+				pollfd writing = { _fd, POLLOUT, 0 };
+				if (poll(&writing, 1, SOCKET_LINUX_SERIAL_WRITE_MS) <= 0) return false;
+			} else {
+
+				#ifdef SOCKET_LINUX_SERIAL_DEBUG
+				Serial.print(F("\tsend: Failed with errno "));
+				Serial.println(errno);
+				#endif
+
+				return false;
+			}
+		}
+		return true;
+    }
+
+
+public:
+
+    // Move ONLY the singleton instance method to subclass
+    static S_SocketLinux_Serial& instance() {
+        static S_SocketLinux_Serial instance;
+        return instance;
+    }
+
+
+	int _eventFd() const override { return _fd; }
+
+
+    /**
+     * @brief Opens the serial device in raw and non blocking mode
+     * @param device The device path, like `"/dev/ttyUSB0"`
+     * @param baud_rate One of the standard rates, from 9600 up to 4000000
+     * @return false if the device couldn't be opened or the baud rate isn't a standard one
+	 *
+     * @note The same baud rate has to be used by the board in `Serial.begin`.
+     */
+	bool begin(const char* device, uint32_t baud_rate = 115200) {
+		end();
+		const speed_t speed = _speed(baud_rate);
+		if (speed == B0) return false;
+		_fd = open(device, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+		if (_fd < 0) return false;
+
+		termios settings;
+		if (tcgetattr(_fd, &settings) != 0) {
+			end();
+			return false;
+		}
+		cfmakeraw(&settings);
+		settings.c_cflag |= CLOCAL | CREAD;		// Ignores the modem lines
+		settings.c_cflag &= ~CRTSCTS;
+		settings.c_cc[VMIN] = 0;
+		settings.c_cc[VTIME] = 0;
+		if (cfsetispeed(&settings, speed) != 0
+			|| cfsetospeed(&settings, speed) != 0
+			|| tcsetattr(_fd, TCSANOW, &settings) != 0) {
+
+			#ifdef SOCKET_LINUX_SERIAL_DEBUG
+			Serial.print(F("\tbegin: Failed with errno "));
+			Serial.println(errno);
+			#endif
+
+			end();
+			return false;
+		}
+		tcflush(_fd, TCIFLUSH);		// Drops what the board sent before being opened
+		_eventFdChanged();	// Waited for by the Repeater even if opened after `beginEpoll`
+		return true;
+	}
+
+
+    /** @brief Closes the device, any partial frame is dropped */
+	void end() {
+		if (_fd < 0) return;
+		close(_fd);
+		_fd = -1;
+		_frames.reset();
+		_eventFdChanged();
+	}
+
+
+    /** @brief The device file descriptor, `-1` if not open, for `poll` or `epoll` like waits */
+	int get_fd() const { return _fd; }
+
+    /** @brief The `read` system calls done, including the ones that found nothing to read */
+	uint32_t get_read_calls() const { return _read_calls; }
+
+};
+
+#endif // SOCKET_LINUX_SERIAL_HPP
@@ -106,6 +106,7 @@ protected:
 				}
 			}
             _max_delay_ms = 0;  // SPI is sequencial, no need to control out of order packages
+            _hub = true;  // Slaves only hear each other through the Master
         }
 
     
@@ -15,15 +15,20 @@ https://github.com/ruiseixasm/JsonTalkie
 #include "S_Broadcast_SPI_Arduino_Slave.h"
 
 
-char S_Broadcast_SPI_Arduino_Slave::_received_buffer[TALKIE_BUFFER_SIZE];
-char S_Broadcast_SPI_Arduino_Slave::_sending_buffer[TALKIE_BUFFER_SIZE];
+char S_Broadcast_SPI_Arduino_Slave::_received_buffers[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES][TALKIE_BUFFER_SIZE];
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_received_lengths[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES];
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_received_head = 0;
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_received_tail = 0;
+char S_Broadcast_SPI_Arduino_Slave::_sending_buffers[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES][TALKIE_BUFFER_SIZE];
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_sending_lengths[BROADCAST_SPI_ARDUINO_SLAVE_FRAMES];
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_sending_head = 0;
+volatile uint8_t S_Broadcast_SPI_Arduino_Slave::_sending_tail = 0;
 
 volatile size_t S_Broadcast_SPI_Arduino_Slave::_receiving_index = 0;
-volatile size_t S_Broadcast_SPI_Arduino_Slave::_received_length = 0;
 volatile size_t S_Broadcast_SPI_Arduino_Slave::_sending_index = 0;
-volatile size_t S_Broadcast_SPI_Arduino_Slave::_sending_length = 0;
 volatile S_Broadcast_SPI_Arduino_Slave::StatusByte S_Broadcast_SPI_Arduino_Slave::_transmission_mode 
 									= S_Broadcast_SPI_Arduino_Slave::StatusByte::TALKIE_SB_NONE;
+S_Broadcast_SPI_Arduino_Slave* S_Broadcast_SPI_Arduino_Slave::_interrupt_socket = nullptr;
 
 
 // Define ISR at GLOBAL SCOPE (outside the class)
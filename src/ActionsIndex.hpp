@@ -0,0 +1,164 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file ActionsIndex.hpp
+ * @brief Compile time sorted index of the Manifesto Actions names, so that calls
+ *        by name are found with a binary search instead of a linear one.
+ *
+ * @warning Only C++11 `constexpr` is used, so that it compiles in the AVR toolchain too.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef ACTIONS_INDEX_HPP
+#define ACTIONS_INDEX_HPP
+
+#include <Arduino.h>
+#include "TalkerManifesto.hpp"
+
+
+template <uint8_t... I>
+struct ActionSequence {};
+
+template <uint8_t N, uint8_t... I>
+struct MakeActionSequence : MakeActionSequence<N - 1, N - 1, I...> {};
+
+template <uint8_t... I>
+struct MakeActionSequence<0, I...> {
+	typedef ActionSequence<I...> type;
+};
+
+
+/**
+ * @class ActionsIndex
+ * @brief Finds the index of an Action by its name in `O(log n)` steps
+ *
+ * The Actions array is sorted by name at compile time into a table of indexes that is
+ * kept in flash (PROGMEM), so, no RAM is used and the Actions keep their declared order.
+ *
+ * @tparam Manifesto A Manifesto with its Actions as `static constexpr Action actions[]`
+ */
+template <class Manifesto>
+class ActionsIndex {
+public:
+
+	static constexpr uint8_t count = sizeof(Manifesto::actions) / sizeof(Action);
+	static_assert(count > 0 && count < 255, "A Manifesto can only have between 1 and 254 Actions");
+
+
+	/** @brief The same order as `strcmp`, where chars are compared as unsigned */
+	static constexpr int _compareNames(const char* name_a, const char* name_b) {
+		return (*name_a != *name_b || *name_a == '\0')
+			? (int)(uint8_t)*name_a - (int)(uint8_t)*name_b
+			: _compareNames(name_a + 1, name_b + 1);
+	}
+
+	/** @brief The amount of Actions with a name lower than the one of the Action `action_i` */
+	static constexpr uint8_t _rank(uint8_t action_i, uint8_t action_j = 0) {
+		return action_j < count
+			? (uint8_t)((_compareNames(Manifesto::actions[action_j].name, Manifesto::actions[action_i].name) < 0) + _rank(action_i, action_j + 1))
+			: 0;
+	}
+
+	/** @brief The Action index at the sorted position `position`, 255 if none (duplicated names) */
+	static constexpr uint8_t _sorted(uint8_t position, uint8_t action_i = 0) {
+		return action_i < count
+			? (_rank(action_i) == position ? action_i : _sorted(position, action_i + 1))
+			: 255;
+	}
+
+	/** @brief Confirms that every sorted position has an Action, meaning no duplicated names */
+	static constexpr bool _unique(uint8_t position = 0) {
+		return position < count ? _sorted(position) < 255 && _unique(position + 1) : true;
+	}
+
+
+	template <class Sequence>
+	struct Table;
+
+	template <uint8_t... P>
+	struct Table<ActionSequence<P...>> {
+		static const uint8_t sorted[sizeof...(P)];
+	};
+
+	typedef Table<typename MakeActionSequence<count>::type> SortedTable;
+
+
+    /**
+     * @brief Returns the index Action for a given Action name
+     * @param name The name of the Action
+     * @return The index number of the action or 255 if none was found
+     */
+	static uint8_t find(const char* name) {
+		static_assert(_unique(), "Each Action of a Manifesto must have a different name");
+		uint8_t low = 0;
+		uint8_t high = count;
+		while (low < high) {
+			const uint8_t middle = (uint8_t)((low + high) / 2);
+			const uint8_t action_i = pgm_read_byte(&SortedTable::sorted[middle]);
+			const int comparison = strcmp(name, Manifesto::actions[action_i].name);
+			if (comparison == 0) return action_i;
+			if (comparison < 0) {
+				high = middle;
+			} else {
+				low = middle + 1;
+			}
+		}
+		return 255;
+	}
+};
+
+template <class Manifesto>
+template <uint8_t... P>
+const uint8_t ActionsIndex<Manifesto>::Table<ActionSequence<P...>>::sorted[sizeof...(P)] PROGMEM = {
+	ActionsIndex<Manifesto>::_sorted(P)...
+};
+
+
+/**
+ * @class IndexedManifesto
+ * @brief A Manifesto that opts in the `ActionsIndex` lookup of its Actions by name
+ *
+ * The implementation declares its Actions as static, and then, the methods `_getActionsArray`
+ * and `_actionsCount` are no longer needed, like so:
+ * ```cpp
+ * class M_MyManifesto : public IndexedManifesto<M_MyManifesto> {
+ * public:
+ *     static constexpr Action actions[2] = {{"on", "Turns led ON"}, {"off", "Turns led OFF"}};
+ * ...
+ * };
+ * constexpr Action M_MyManifesto::actions[2];	// Only needed before C++17
+ * ```
+ *
+ * @tparam Manifesto The Manifesto class itself (CRTP)
+ */
+template <class Manifesto>
+class IndexedManifesto : public TalkerManifesto {
+public:
+
+	using TalkerManifesto::_actionIndex;	// Keeps the index based overload visible
+
+    const Action* _getActionsArray() const override { return Manifesto::actions; }
+
+    uint8_t _actionsCount() const override { return ActionsIndex<Manifesto>::count; }
+
+    uint8_t _actionIndex(const char* name) const override { return ActionsIndex<Manifesto>::find(name); }
+};
+
+
+#endif // ACTIONS_INDEX_HPP
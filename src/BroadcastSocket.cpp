@@ -25,6 +25,29 @@ void BroadcastSocket::_setLink(MessageRepeater* message_repeater, LinkType link_
 }
 
 
+void BroadcastSocket::_signalEvent() {
+	_event_pending = true;
+	#ifdef ESP32
+	if (_io_task) {	// Dual core mode, it's the I/O task that receives
+		MessageRepeater::_notifyTask(_io_task);
+		return;
+	}
+	#endif
+	if (_message_repeater) {
+		_message_repeater->_wakeUp();
+	}
+}
+
+
+#ifdef __linux__
+void BroadcastSocket::_eventFdChanged() {
+	if (_message_repeater) {
+		_message_repeater->_reregisterSocket(this);
+	}
+}
+#endif
+
+
 void BroadcastSocket::_transmitToRepeater(JsonMessage& json_message) {
 
 	#ifdef MESSAGE_REPEATER_DEBUG
@@ -33,13 +56,31 @@ void BroadcastSocket::_transmitToRepeater(JsonMessage& json_message) {
 	Serial.println();  // optional: just to add a newline after the JSON
 	#endif
 
+	#ifdef ESP32
+	if (_io_task) {	// Dual core mode, the routing is done by the Repeater loop
+		if (_inbound_ring->push(json_message)) {
+			if (_message_repeater) _message_repeater->_wakeUp();
+		} else {
+			++_drops_count;
+		}
+		return;
+	}
+	#endif
+	_routeByRepeater(json_message);
+}
+
+
+void BroadcastSocket::_routeByRepeater(JsonMessage& json_message) {
 	if (_message_repeater) {
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		TimingScope timing(_timings[TalkieCodes::TALKIE_TM_ROUTE]);
+		#endif
 		switch (_link_type) {
 			case LinkType::TALKIE_LT_UP_LINKED:
 				_message_repeater->_socketDownlink(*this, json_message);
 				break;
 			case LinkType::TALKIE_LT_DOWN_LINKED:
-				_message_repeater->_socketUplink(json_message);
+				_message_repeater->_socketUplink(*this, json_message);
 				break;
 			default: break;
 		}
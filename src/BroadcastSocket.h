@@ -34,6 +34,13 @@ https://github.com/ruiseixasm/JsonTalkie
 
 #include <Arduino.h>    // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 #include "JsonMessage.hpp"
+#include "MessageRing.hpp"
+#include "TalkieCounters.hpp"
+#include "TalkiePeers.hpp"
+#include "TalkieFrames.hpp"
+#ifdef ESP32
+#include <new>		// std::nothrow
+#endif
 
 
 // #define BROADCASTSOCKET_DEBUG
@@ -55,6 +62,7 @@ using MuteValue 		= TalkieCodes::MuteValue;
 using RogerValue 		= TalkieCodes::RogerValue;
 using ErrorValue 		= TalkieCodes::ErrorValue;
 using ValueType 		= TalkieCodes::ValueType;
+using TimingValue 		= TalkieCodes::TimingValue;
 
 class MessageRepeater;
 
@@ -75,6 +83,7 @@ protected:
 	MessageRepeater* _message_repeater = nullptr;
 	LinkType _link_type = LinkType::TALKIE_LT_NONE;
 	bool _bridged = false;	///< Bridged: Can send and receive LOCAL broadcast messages too
+	bool _hub = false;		///< Hub: Its peers can't hear each other, so, it repeats back what it receives
     uint8_t _max_delay_ms = 5;
     bool _control_timing = false;
     unsigned long _last_local_time = 0;	// millis() compatible
@@ -84,7 +93,38 @@ protected:
     uint16_t _drops_count = 0;
     uint16_t _fails_count = 0;
 	uint8_t _consecutive_errors = 0;	// Avoids a runaway flux of errors
+	#ifndef TALKIE_NO_SYSTEM_STATS
+	uint32_t _messages_in = 0;
+	uint32_t _messages_out = 0;
+	uint32_t _bytes_sent = 0;
+	TimingCounter _timings[TalkieCodes::TALKIE_TM_SEND + 1];	///< Indexed by `TimingValue`, in dual core mode only the route one isn't written by the I/O task
+	#endif
+	volatile bool _event_pending = false;	///< Set by `_signalEvent`, it can be set inside an ISR
+	
+	#ifndef TALKIE_NO_BATCHING
+	// Frame batching, the buffer is given by the Socket implementation with `_enableBatching`
+	char* _batch_buffer = nullptr;
+	uint16_t _batch_size = 0;
+	uint16_t _batch_length = 0;
+	uint8_t _batch_frames = 0;
+	uint16_t _batch_window_us = 0;	///< A window of 0 microseconds means no batching
+	uint32_t _batch_start_us = 0;
+	uint32_t _batch_destination = 0;
+	uint16_t _batches_count = 0;
+	uint16_t _batched_count = 0;
+	#endif
 	
+	#ifdef ESP32
+	TaskHandle_t _io_task = nullptr;	///< The Socket I/O task in dual core mode, nullptr if single threaded
+	uint16_t _ring_fails_count = 0;		///< Messages not queued for the I/O task, apart given that the I/O task writes `_fails_count`
+	// Allocated by `beginDualCore` only, given that each ring takes TALKIE_RING_SIZE messages of RAM
+	MessageRing<TALKIE_RING_SIZE>* _inbound_ring = nullptr;		///< Received messages, from the I/O core to the routing core
+	MessageRing<TALKIE_RING_SIZE>* _outbound_ring = nullptr;	///< Messages to be sent, from the routing core to the I/O core
+	#endif
+	#ifdef __linux__
+	bool _readiness_driven = false;	///< Only receives when its file descriptor is readable, as waited by the Repeater
+	#endif
+
 
     enum CorruptionType : uint8_t {
 		TALKIE_CT_CLEAN,
@@ -127,10 +167,142 @@ protected:
     /**
      * @brief Sends the generated message by _startTransmission
 	 *        to the Repeater
+	 * 
+     * @note In dual core mode the message is queued for the routing core instead.
      */
 	void _transmitToRepeater(JsonMessage& json_message);
 
 
+    /** @brief Routes the message by the Repeater accordingly to the Socket link type */
+	void _routeByRepeater(JsonMessage& json_message);
+
+
+    /**
+     * @brief Signals the Repeater that there is data to be received,
+	 *        waking it up if waiting in its `idleLoop`
+	 * 
+     * @note This method is ISR safe and intended for Sockets with callbacks or interrupts.
+     */
+	void _signalEvent();
+
+
+	#ifndef TALKIE_NO_BATCHING
+    /**
+     * @brief Enables the batching of the sent frames into a single datagram
+     * @param batch_buffer The buffer where the frames are packed, owned by the Socket implementation
+     * @param batch_size The size of the buffer, the maximum size of a datagram
+     * @param window_us The maximum time a frame waits for other frames, `0` disables batching
+	 * 
+     * @note Only for datagram Sockets, which shall implement the `_sendBatch` method.
+     */
+	void _enableBatching(char* batch_buffer, uint16_t batch_size, uint16_t window_us) {
+		_flushBatch();
+		_batch_buffer = batch_buffer;
+		_batch_size = batch_size;
+		_batch_window_us = batch_buffer ? window_us : 0;
+	}
+
+
+    /**
+     * @brief Adds an already checksummed frame to the batch, flushing the batch first if the
+	 *        frame doesn't fit in it or if it's for a different destination
+     * @param json_message The json message frame to be batched
+     * @param destination An identifier of the destination given by the Socket (ex. an IPv4 address)
+     * @return true if batched or sent
+	 * 
+     * @note A batch is a json array of frames like `[{...},{...}]`, a batch with a single frame
+	 *       is sent without the array envelope, so, it's understood by non batching Sockets.
+     */
+	bool _batchFrame(const JsonMessage& json_message, uint32_t destination) {
+		const uint16_t frame_length = (uint16_t)json_message.get_length();
+		if (_batch_length && (destination != _batch_destination || _batch_length + 1 + frame_length + 1 > _batch_size)) {
+			_flushBatch();
+		}
+		if (1 + frame_length + 1 > _batch_size) {	// Doesn't fit in an empty batch either
+			return _sendBatch(json_message._read_buffer(), frame_length, destination);
+		}
+		if (_batch_length == 0) {
+			_batch_buffer[_batch_length++] = '[';
+			_batch_destination = destination;
+			_batch_start_us = micros();
+		} else {
+			_batch_buffer[_batch_length++] = ',';
+		}
+		memcpy(_batch_buffer + _batch_length, json_message._read_buffer(), frame_length);
+		_batch_length += frame_length;
+		++_batch_frames;
+		return true;
+	}
+
+
+    /** @brief Sends the pending batch, if any, regardless of its window */
+	void _flushBatch() {
+		if (_batch_length == 0) return;
+		bool batch_sent = false;
+		if (_batch_frames == 1) {
+			batch_sent = _sendBatch(_batch_buffer + 1, _batch_length - 1, _batch_destination);
+		} else {
+			_batch_buffer[_batch_length++] = ']';
+			batch_sent = _sendBatch(_batch_buffer, _batch_length, _batch_destination);
+			if (batch_sent) {
+				++_batches_count;
+				_batched_count += _batch_frames;
+			}
+		}
+		if (!batch_sent) {	// Already counted as sent by `_timedSend` when batched
+			_countUnsent(_batch_frames, _batch_frames == 1 ? _batch_length - 1 : _batch_length - _batch_frames - 1);
+		}
+		_batch_length = 0;
+		_batch_frames = 0;
+	}
+	#endif
+
+
+    /**
+     * @brief Starts the transmission of each frame of a received batch
+     * @param batch The received datagram, a json array of frames like `[{...},{...}]`
+     * @param length The length of the received datagram
+     */
+	void _startBatchTransmission(const char* batch, size_t length) {
+		size_t frame_start = 0;
+		uint8_t depth = 0;
+		bool in_string = false;
+		for (size_t char_j = 1; char_j < length; ++char_j) {
+			const char c = batch[char_j];
+			if (in_string) {
+				if (c == '"' && batch[char_j - 1] != '\\') in_string = false;
+			} else if (c == '"') {
+				in_string = true;
+			} else if (c == '{') {
+				if (depth++ == 0) frame_start = char_j;
+			} else if (c == '}' && depth > 0 && --depth == 0) {
+				JsonMessage frame_message;
+				if (frame_message.deserialize_buffer(batch + frame_start, char_j - frame_start + 1)) {
+					_startTransmission(frame_message);
+				}
+			}
+		}
+	}
+
+
+	#ifndef TALKIE_NO_BATCHING
+    /**
+     * @brief Sends a datagram with one or more frames, intended to be implemented
+	 *        by the datagram Sockets that enable batching
+     * @param datagram The datagram to be sent
+     * @param length The length of the datagram
+     * @param destination The destination identifier given to `_batchFrame`
+     * @return false if not sent
+     */
+	virtual bool _sendBatch(const char* datagram, size_t length, uint32_t destination) {
+        (void)datagram;		// Silence unused parameter warning
+        (void)length;		// Silence unused parameter warning
+        (void)destination;	// Silence unused parameter warning
+		return false;
+	}
+	#endif
+
+
     /** @brief Allows the visualization of the message before transmission */
 	virtual void _showMessage(const JsonMessage& json_message) {
         (void)json_message;	// Silence unused parameter warning
@@ -294,6 +466,10 @@ protected:
 	 *        usefull if you wan't to do it in the Socket implementation instead
      */
     void _startTransmission(JsonMessage& json_message, bool check_integrity = true) {
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		TimingScope timing(_timings[TalkieCodes::TALKIE_TM_START]);
+		++_messages_in;
+		#endif
 		
 		#ifdef MESSAGE_DEBUG_TIMING
 		Serial.print("\n\t");
@@ -576,6 +752,47 @@ protected:
     virtual bool _send(const JsonMessage& json_message) = 0;
 
 
+	/**
+     * @brief Calls `_send` while keeping its timing and traffic counters
+     * @param json_message A json message to be sent
+     * @return true if sent
+     */
+	bool _timedSend(const JsonMessage& json_message) {
+		#ifdef TALKIE_NO_SYSTEM_STATS
+		const bool message_sent = _send(json_message);
+		#else
+		bool message_sent;
+		{
+			TimingScope timing(_timings[TalkieCodes::TALKIE_TM_SEND]);
+			message_sent = _send(json_message);
+		}
+		if (message_sent) {
+			++_messages_out;
+			_bytes_sent += json_message.get_length();
+		}
+		#endif
+		if (!message_sent) ++_fails_count;
+		return message_sent;
+	}
+
+
+	/**
+     * @brief Counts as failed the frames already counted as sent, for the Sockets that only
+	 *        find out after `_send` that they weren't sent after all (ex. queued or batched frames)
+     * @param frames The amount of frames not sent
+     * @param bytes The sum of their lengths
+     */
+	void _countUnsent(uint8_t frames, uint32_t bytes) {
+		_fails_count += frames;
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		_messages_out -= frames;
+		_bytes_sent -= bytes;
+		#else
+        (void)bytes;		// Silence unused parameter warning
+		#endif
+	}
+
+
 public:
     // Delete copy/move operations
     BroadcastSocket(const BroadcastSocket&) = delete;
@@ -623,10 +840,141 @@ public:
 
 			_corrupted_message.active = false;
 		}
+		#ifndef TALKIE_NO_BATCHING
+		if (_batch_length && micros() - _batch_start_us >= _batch_window_us) {
+			_flushBatch();
+		}
+		#endif
+		#ifdef __linux__
+		if (_readiness_driven && !_event_pending) return;	// Nothing to be read
+		#endif
+		_event_pending = false;	// Any data signaled is going to be received right now
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		TimingScope timing(_timings[TalkieCodes::TALKIE_TM_RECEIVE]);
+		#endif
         _receive();
     }
 
 
+	/**
+     * @brief Returns how long the Repeater can stay idle without calling the `_loop` method
+     * @return The idle time in milliseconds, where `0` means there is data to be received
+	 * 
+     * @note Sockets that can check for available data without reading it, like `Serial.available()`,
+	 *       should override this method, otherwise they are polled every `TALKIE_POLL_INTERVAL_MS`.
+     */
+	virtual uint32_t _idleTime() const {
+		if (_event_pending) return 0;
+		#ifndef TALKIE_NO_BATCHING
+		if (_batch_length) {	// Waits for the batch window to close
+			const uint32_t elapsed_us = micros() - _batch_start_us;
+			return elapsed_us < _batch_window_us ? (_batch_window_us - elapsed_us) / 1000 : 0;
+		}
+		#endif
+		#ifdef ESP32
+		if (_outbound_ring && !_outbound_ring->empty()) return 0;
+		#endif
+		#ifdef __linux__
+		if (_readiness_driven) return TALKIE_IDLE_MAX_MS;	// Woken up by its file descriptor
+		#endif
+		return TALKIE_POLL_INTERVAL_MS;
+	}
+
+
+	#ifdef __linux__
+
+	/**
+     * @brief The file descriptor that becomes readable when there is data to be received,
+	 *        so that the Repeater waits for it with `epoll` instead of polling the Socket
+     * @return The file descriptor or `-1` if none, in which case the Socket is polled as usual
+	 * 
+     * @note This method is used by the Message Repeater `beginEpoll` method.
+     */
+	virtual int _eventFd() const { return -1; }
+
+
+	/** @brief Sets the Socket to receive only after being marked as ready by `_setReady` */
+	void _setReadinessDriven(bool readiness_driven) { _readiness_driven = readiness_driven; }
+
+
+	/** @brief Marks the Socket as having data to be received in its next `_loop`, without waking the Repeater */
+	void _setReady() { _event_pending = true; }
+
+
+	/**
+     * @brief Tells the Repeater that the `_eventFd` changed, so that the new one is waited for instead
+	 * 
+     * @note Sockets shall call it each time their file descriptor is opened or closed.
+     */
+	void _eventFdChanged();
+
+	#endif
+
+
+	#ifdef ESP32
+
+	/**
+     * @brief Sets the dual core mode by giving the I/O task that calls `_ioLoop`
+     * @param io_task The I/O task handle or nullptr to go back to single threaded
+	 * 
+     * @note This method is used by the Message Repeater `beginDualCore` method.
+     */
+	void _setIOTask(TaskHandle_t io_task) { _io_task = io_task; }
+
+
+	/**
+     * @brief Allocates the rings between cores, if not yet allocated, before the I/O task is set
+     * @return false if there isn't enough heap for them
+	 * 
+     * @note This method is used by the Message Repeater `beginDualCore` method, and the rings are then kept.
+     */
+	bool _allocateRings() {
+		if (!_inbound_ring) _inbound_ring = new (std::nothrow) MessageRing<TALKIE_RING_SIZE>();
+		if (!_outbound_ring) _outbound_ring = new (std::nothrow) MessageRing<TALKIE_RING_SIZE>();
+		return _inbound_ring && _outbound_ring;
+	}
+
+
+	/**
+     * @brief Method intended to be called by the I/O task in dual core mode,
+	 *        it sends the queued messages and then does the usual `_loop`
+	 * 
+     * @note This method being underscored means to be called internally only.
+     */
+	void _ioLoop() {
+		JsonMessage json_message;
+		while (_outbound_ring->pop(json_message)) {
+			_timedSend(json_message);
+		}
+		_loop();
+	}
+
+
+	/**
+     * @brief Method intended to be called by the Repeater loop in dual core mode,
+	 *        it routes the messages received by the I/O task
+	 * 
+     * @note This method being underscored means to be called internally only.
+     */
+	void _routeLoop() {
+		JsonMessage json_message;
+		for (uint8_t message_i = 0; message_i < TALKIE_RING_SIZE && _inbound_ring->pop(json_message); ++message_i) {
+			_routeByRepeater(json_message);
+		}
+	}
+
+
+	/**
+     * @brief The idle time of the routing side in dual core mode
+     * @return `0` if there are received messages to be routed
+     */
+	uint32_t _routeIdleTime() const {
+		return _inbound_ring->empty() ? TALKIE_IDLE_MAX_MS : 0;
+	}
+
+	#endif
+
+
     // ============================================
     // GETTERS - FIELD VALUES
     // ============================================
@@ -684,7 +1032,66 @@ public:
      * 
      * @note A failed message is a message that failed to be sent
      */
-    uint16_t get_fails_count() const { return _fails_count; }
+    uint16_t get_fails_count() const {
+		#ifdef ESP32
+		return _fails_count + _ring_fails_count;	// Each one written by a single core in dual core mode
+		#else
+		return _fails_count;
+		#endif
+	}
+
+	
+	#ifndef TALKIE_NO_BATCHING
+    /**
+     * @brief Get the total amount of datagrams sent with batched frames
+     * @return Returns the number of sent batches with more than one frame
+     */
+    uint16_t get_batches_count() const { return _batches_count; }
+
+	
+    /**
+     * @brief Get the total amount of frames sent inside batches
+     * @return Returns the number of batched frames
+     * 
+     * @note The ratio between batched frames and batches is the datagrams saved by batching.
+     */
+    uint16_t get_batched_count() const { return _batched_count; }
+	#endif
+
+	
+	#ifndef TALKIE_NO_SYSTEM_STATS
+    /**
+     * @brief Get the total amount of messages received, corrupted ones included
+     * @return Returns the number of messages that started a transmission
+     */
+    uint32_t get_messages_in() const { return _messages_in; }
+
+	
+    /**
+     * @brief Get the total amount of messages successfully sent
+     * @return Returns the number of sent messages
+     */
+    uint32_t get_messages_out() const { return _messages_out; }
+
+	
+    /**
+     * @brief Get the total amount of bytes successfully sent
+     * @return Returns the sum of the sent messages lengths
+     */
+    uint32_t get_bytes_sent() const { return _bytes_sent; }
+
+	
+    /**
+     * @brief Get the time spent by the Socket in a given processing step
+     * @param timing_value The processing step (ex. TALKIE_TM_SEND)
+     * @return Returns the timing counter of that step
+     * 
+     * @note Each step includes the time of the steps it calls, like routing including the sending.
+     */
+    const TimingCounter& get_timing(TimingValue timing_value) const {
+		return _timings[timing_value <= TalkieCodes::TALKIE_TM_SEND ? timing_value : TalkieCodes::TALKIE_TM_SEND];
+	}
+	#endif
 
 	
     /**
@@ -694,6 +1101,15 @@ public:
 	bool isBridged() const {
 		return _bridged;
 	}
+
+
+    /**
+     * @brief Get the hub nature of the Socket
+     * @return true if its peers can only hear each other through it (ex. SPI Master)
+     */
+	bool isHub() const {
+		return _hub;
+	}
 	
 
     // ============================================
@@ -718,6 +1134,19 @@ public:
 	 *       this only applies to `CALL` messages value
      */
     void set_max_delay(uint8_t max_delay_ms = 5) { _max_delay_ms = max_delay_ms; }
+
+
+	#ifndef TALKIE_NO_SYSTEM_STATS
+    /** @brief Resets the traffic and timing counters, the errors ones are kept */
+    void reset_counters() {
+		_messages_in = 0;
+		_messages_out = 0;
+		_bytes_sent = 0;
+		for (TimingCounter& timing : _timings) {
+			timing.reset();
+		}
+	}
+	#endif
 	
 
     /**
@@ -770,16 +1199,26 @@ public:
 			Serial.println();  // optional: just to add a newline after the JSON
 			#endif
 
-			message_sent = _send(json_message);
+			#ifdef ESP32
+			if (_io_task && xTaskGetCurrentTaskHandle() != _io_task) {
+				// Dual core mode, the sending is done by the I/O task
+				message_sent = _outbound_ring->push(json_message);
+				if (message_sent) {
+					xTaskNotifyGive(_io_task);
+				} else {
+					++_ring_fails_count;	// While `_fails_count` is written by the I/O task
+				}
+			} else {
+				message_sent = _timedSend(json_message);
+			}
+			#else
+			message_sent = _timedSend(json_message);
+			#endif
 
 			#ifdef MESSAGE_DEBUG_TIMING
 			Serial.print(" | ");
 			Serial.print(millis() - json_message._reference_time);
 			#endif
-
-			if (!message_sent) {
-				++_fails_count;
-			}
 		}
 		return message_sent;
     }
@@ -40,6 +40,10 @@ https://github.com/ruiseixasm/JsonTalkie
 #include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 #include "TalkieCodes.hpp"
 
+#ifndef FPSTR	// Already defined by the ESP cores
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper*>(pstr_pointer))
+#endif
+
 // Guaranteed memory safety, constrained / schema-driven JSON protocol
 // Advisable maximum sizes:
 // 		f (from / name) → 16 bytes (15 + '\0')
@@ -75,6 +79,56 @@ class BroadcastSocket;
 class JsonMessage {
 public:
 
+	/**
+	 * @brief The values `0` to `9` of a message decoded at once, instead of each `get_nth_value_*`
+	 *        call scanning the whole message again
+	 * 
+	 * @warning The strings are read from the message, so, only until the message is changed.
+	 */
+	struct Arguments {
+		uint16_t present = 0;			///< A bit per nth value present
+		ValueType types[10];
+		uint32_t numbers[10];			///< The TALKIE_VT_INTEGER values
+		uint16_t positions[10];			///< Where the TALKIE_VT_STRING values start in the message
+		uint16_t lengths[10];
+		const char* payload = nullptr;
+
+		/** @brief Check if the nth value exists */
+		bool has(uint8_t nth) const {
+			return nth < 10 && (present >> nth & 1);
+		}
+
+		/** @brief Get the nth value type, TALKIE_VT_VOID if none */
+		ValueType get_type(uint8_t nth) const {
+			return has(nth) ? types[nth] : ValueType::TALKIE_VT_VOID;
+		}
+
+		/** @brief Get the nth value as number, or 0 if not a number */
+		uint32_t get_number(uint8_t nth) const {
+			return get_type(nth) == ValueType::TALKIE_VT_INTEGER ? numbers[nth] : 0;
+		}
+
+		/**
+		 * @brief Get the nth value as string, validated as a name for a size equal to TALKIE_NAME_LEN
+		 * @return false if not a string or if it doesn't fit the buffer
+		 */
+		bool get_string(uint8_t nth, char* buffer, size_t size = TALKIE_MAX_LEN) const {
+			if (!buffer || !size) return false;
+			buffer[0] = '\0';	// Safe code, no surprises
+			if (get_type(nth) != ValueType::TALKIE_VT_STRING || lengths[nth] >= size) return false;
+			for (uint16_t char_j = 0; char_j < lengths[nth]; ++char_j) {
+				const char string_char = payload[positions[nth] + char_j];
+				if (size == TALKIE_NAME_LEN && !_validate_name_char(string_char, char_j)) {
+					buffer[0] = '\0';
+					return false;
+				}
+				buffer[char_j] = string_char;
+			}
+			buffer[lengths[nth]] = '\0';
+			return true;
+		}
+	};
+
 	#ifdef MESSAGE_DEBUG_TIMING
 	unsigned long _reference_time = millis();
 	#endif
@@ -702,6 +756,28 @@ public:
 	}
 
 
+    /**
+     * @brief Appends already serialized fields, like `"0":1,"1":"on"`, right before the closing '}'
+     * @param fields The serialized fields without any heading or tailing ','
+     * @param length The length of the serialized fields
+     * @return true if it has space for the fields
+     * 
+     * @note Being a single copy, the keys of the fields must NOT be present in the message
+     */
+	bool _append_fields(const char* fields, size_t length) {
+		if (length == 0) return true;
+		if (_json_length < 2) return false;
+		size_t comma = _json_length > 2 ? 1 : 0;	// The edge case of '{}' has no ',' separation
+		if (_json_length + comma + length > TALKIE_BUFFER_SIZE) return false;
+		size_t setting_position = _json_length - 1;	// At the '}' position
+		if (comma) _json_payload[setting_position++] = ',';
+		memcpy(&_json_payload[setting_position], fields, length);
+		_json_payload[setting_position + length] = '}';
+		_json_length += comma + length;
+		return true;
+	}
+
+
     /**
      * @brief Allows a read only access to the message buffer
      * @return A constant pointer to the message buffer
@@ -1072,6 +1148,12 @@ public:
 	}
 
 
+	/** @brief Check if hop count field exists (only set by Repeaters forwarding between Sockets) */
+	bool has_hop_count() const {
+		return _get_colon_position('h') > 0;
+	}
+
+
     /**
      * @brief Check if nth value field exists (0-9)
      * @param nth Index 0-9
@@ -1479,6 +1561,18 @@ public:
 	ErrorValue get_error_value() const {
 		return static_cast<ErrorValue>( _get_value_single_digit_number('e') );
 	}
+
+
+    /**
+     * @brief Get the Socket to Socket hops left for the message
+     * @return The hop count, or TALKIE_MAX_HOPS if the message was never forwarded
+     */
+	uint8_t get_hop_count() const {
+		if (has_hop_count()) {
+			return (uint8_t)_get_value_single_digit_number('h');
+		}
+		return TALKIE_MAX_HOPS;
+	}
 	
 
     /**
@@ -1634,6 +1728,51 @@ public:
 		return false;
 	}
 
+
+    /**
+     * @brief Decodes all the nth values in a single pass over the message
+     * @param arguments The decoded values, with the same types given by `get_nth_value_type`
+     */
+	void decode_arguments(Arguments& arguments) const {
+		arguments.present = 0;
+		arguments.payload = _json_payload;
+		for (size_t json_i = 4; json_i < _json_length; ++json_i) {
+			if (_json_payload[json_i] != ':' || _json_payload[json_i - 1] != '"' || _json_payload[json_i - 3] != '"') continue;
+			const char key = _json_payload[json_i - 2];
+			const bool nth_key = key >= '0' && key <= '9';
+			const uint8_t nth = (uint8_t)(key - '0');
+			size_t value_i = json_i + 1;
+			if (value_i < _json_length && _json_payload[value_i] == '"') {
+				// Any string is skipped as a whole, so that its content is never taken as a key
+				size_t end_i = value_i + 1;
+				while (end_i < _json_length && _json_payload[end_i] != '"') ++end_i;
+				if (nth_key && end_i < _json_length) {
+					arguments.present |= (uint16_t)(1 << nth);
+					arguments.types[nth] = ValueType::TALKIE_VT_STRING;
+					arguments.positions[nth] = (uint16_t)(value_i + 1);
+					arguments.lengths[nth] = (uint16_t)(end_i - value_i - 1);
+				}
+				json_i = end_i;
+			} else if (nth_key) {
+				uint32_t json_number = 0;
+				ValueType value_type = ValueType::TALKIE_VT_INTEGER;
+				for (; value_i < _json_length && _json_payload[value_i] != ',' && _json_payload[value_i] != '}'; ++value_i) {
+					if (_json_payload[value_i] > '9' || _json_payload[value_i] < '0') {
+						value_type = ValueType::TALKIE_VT_OTHER;
+					} else {
+						json_number = json_number * 10 + (uint32_t)(_json_payload[value_i] - '0');
+					}
+				}
+				if (value_i < _json_length) {
+					arguments.present |= (uint16_t)(1 << nth);
+					arguments.types[nth] = value_type;
+					arguments.numbers[nth] = json_number;
+				}
+				json_i = value_i;
+			}
+		}
+	}
+
 	
     /**
      * @brief Get nth value as number
@@ -1796,6 +1935,12 @@ public:
 	}
 
 
+	/** @brief Remove hop count field */
+	void remove_hop_count() {
+		_remove_field('h');
+	}
+
+
     // ============================================
     // SETTERS - FIELD MODIFICATION
     // ============================================
@@ -1974,6 +2119,19 @@ public:
 	}
 
 
+    /**
+     * @brief Set the Socket to Socket hops left for the message
+     * @param hop_count Hops left (0-9)
+     * @return true if successful
+     */
+	bool set_hop_count(uint8_t hop_count) {
+		if (hop_count < 10) {
+			return _set_value_number('h', hop_count);
+		}
+		return false;
+	}
+
+
     /**
      * @brief Set nth value as number
      * @param nth Index 0-9
@@ -2008,6 +2166,27 @@ public:
 	}
 
 
+    /**
+     * @brief Set nth value as string kept in flash (PROGMEM)
+     * @param nth Index 0-9
+     * @param in_string Flash string, like `F("text")` or `FPSTR(progmem_array)`
+     * @param size Maximum string size (up to TALKIE_MAX_LEN)
+     * @return true if successful
+     */
+	bool set_nth_value_string(uint8_t nth, const __FlashStringHelper* in_string, size_t size = TALKIE_MAX_LEN) {
+		if (nth < 10 && in_string) {
+			char ram_string[TALKIE_MAX_LEN + 1];	// Room to always terminate it
+			if (size > TALKIE_MAX_LEN) size = TALKIE_MAX_LEN;
+			strncpy_P(ram_string, reinterpret_cast<const char*>(in_string), size);
+			ram_string[size] = '\0';
+			if (strlen(ram_string) < size) {	// Oversized strings aren't truncated
+				return _set_value_string('0' + nth, ram_string, size);
+			}
+		}
+		return false;
+	}
+
+
     /**
      * @brief Set as a No Reply for `call` messages
 	 * 
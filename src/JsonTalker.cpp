@@ -52,6 +52,7 @@ bool JsonTalker::transmitToRepeater(JsonMessage& json_message) {
 	Serial.println(sent_by_socket);  // 1 means true, 0 means false
 	#endif
 
+	#ifndef TALKIE_NO_RECOVERY
 	if (sent_by_socket && &json_message != &_recovery_message.message) {
 		MessageValue message_value = json_message.get_message_value();
 		// Noise messages aren't recoverable
@@ -59,12 +60,137 @@ bool JsonTalker::transmitToRepeater(JsonMessage& json_message) {
 			_recovery_message.transmitted_time = (uint16_t)millis();
 			_recovery_message.message = json_message;
 			_recovery_message.active = true;
+			TimerWheel::instance().start(_recovery_timer, TALKIE_RECOVERY_TTL, 0, _onTimer, this);
 		}
 	}
+	#endif
 	return sent_by_socket;
 }
 
 
+bool JsonTalker::deferCall(const JsonMessage& json_message, DeferredCall& deferred_call) {
+	if (!json_message.get_identity(&deferred_call.identity)) return false;
+	if (!json_message.get_from_name(deferred_call.from, TALKIE_NAME_LEN)) return false;
+	deferred_call.action_index = json_message.get_action_index();
+	if (deferred_call.action_index < 255) {
+		deferred_call.action[0] = '\0';
+	} else if (!json_message.get_action_name(deferred_call.action, TALKIE_NAME_LEN)) {
+		return false;
+	}
+	deferred_call.broadcast_value = json_message.get_broadcast_value();
+	deferred_call.no_reply = json_message.is_no_reply();
+	deferred_call.active = true;
+	_call_deferred = true;
+	return true;
+}
+
+
+bool JsonTalker::completeCall(DeferredCall& deferred_call, const JsonMessage& json_message, bool roger) {
+	if (!deferred_call.active) return false;
+	deferred_call.active = false;
+	// Rebuilds the echo as if it was sent right away by `handleTransmission`
+	JsonMessage echo_message(MessageValue::TALKIE_MSG_ECHO, deferred_call.broadcast_value);
+	if (roger) {
+		_increment_call_count(TALKIE_CC_ROGERS);
+	} else {
+		_increment_call_count(TALKIE_CC_NEGATIVES);
+		echo_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
+	}
+	_countAction(deferred_call.action_index < 255
+		? _actionIndex(deferred_call.action_index) : _actionIndex(deferred_call.action), roger);
+	if (_mute_value != MuteValue::TALKIE_MV_NONE) return false;
+	if (!(echo_message.set_identity(deferred_call.identity)
+			&& echo_message.set_to_name(deferred_call.from)
+			&& echo_message.set_from_name(_name))) {
+		return false;
+	}
+	if (deferred_call.action_index < 255) {
+		if (!echo_message.set_action_index(deferred_call.action_index)) return false;
+	} else if (!echo_message.set_action_name(deferred_call.action)) {
+		return false;
+	}
+	if (deferred_call.no_reply && !echo_message.set_no_reply()) return false;
+	// The result values are copied at once, given that they are the only fields of the message
+	if (!echo_message._append_fields(json_message._read_buffer() + 1, json_message.get_length() - 2)) return false;
+	return transmitToRepeater(echo_message);
+}
+
+
+#if TALKIE_PENDING_CALLS > 0
+
+bool JsonTalker::call(const char* target, const char* action, const JsonMessage& json_message,
+		CallCallback callback, void* context, uint16_t timeout_ms, BroadcastValue broadcast_value) {
+	PendingCall* pending_call = nullptr;
+	for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+		if (!_pending_calls[call_i].active) {
+			pending_call = &_pending_calls[call_i];
+			break;
+		}
+	}
+	if (!pending_call || !callback) return false;
+	JsonMessage call_message(MessageValue::TALKIE_MSG_CALL, broadcast_value);
+	if (!(call_message.set_to_name(target) && call_message.set_action_name(action))) return false;
+	// The argument values are copied at once, given that they are the only fields of the message
+	if (!call_message._append_fields(json_message._read_buffer() + 1, json_message.get_length() - 2)) return false;
+	pending_call->timeout_ms = timeout_ms;
+	pending_call->sent_us = micros();
+	pending_call->callback = callback;
+	pending_call->context = context;
+	_sending_call = pending_call;	// Activated by `_prepareMessage` with the request identity
+	transmitToRepeater(call_message);
+	if (_sending_call) {	// Not even prepared, so, not sent
+		_sending_call = nullptr;
+		return false;
+	}
+	if (pending_call->active) _expireCalls();	// Rearms the timer for the earliest timeout
+	return true;	// Even if a local echo already answered it
+}
+
+
+bool JsonTalker::_answerCall(const JsonMessage& echo_message) {
+	uint16_t identity;
+	if (!echo_message.get_identity(&identity)) return false;
+	for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+		PendingCall& pending_call = _pending_calls[call_i];
+		if (pending_call.active && pending_call.identity == identity) {
+			pending_call.active = false;	// The callback may send a new request right away
+			pending_call.callback(*this, &echo_message, micros() - pending_call.sent_us, pending_call.context);
+			return true;
+		}
+	}
+	return false;
+}
+
+
+void JsonTalker::_expireCalls() {
+	for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+		PendingCall& pending_call = _pending_calls[call_i];
+		const uint32_t elapsed_us = micros() - pending_call.sent_us;
+		if (pending_call.active && elapsed_us >= (uint32_t)pending_call.timeout_ms * 1000UL) {
+			pending_call.active = false;
+			pending_call.callback(*this, nullptr, elapsed_us, pending_call.context);
+		}
+	}
+	// Only after the callbacks, given that they may have sent new requests
+	uint32_t next_timeout_us = 0xFFFFFFFF;
+	for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+		const PendingCall& pending_call = _pending_calls[call_i];
+		if (!pending_call.active) continue;
+		const uint32_t elapsed_us = micros() - pending_call.sent_us;
+		const uint32_t timeout_us = (uint32_t)pending_call.timeout_ms * 1000UL;
+		const uint32_t remaining_us = elapsed_us < timeout_us ? timeout_us - elapsed_us : 0;
+		if (remaining_us < next_timeout_us) next_timeout_us = remaining_us;
+	}
+	if (next_timeout_us == 0xFFFFFFFF) {
+		TimerWheel::instance().stop(_calls_timer);
+	} else {
+		TimerWheel::instance().start(_calls_timer, next_timeout_us / 1000 + 1, 0, _onTimer, this);
+	}
+}
+
+#endif
+
+
 uint8_t JsonTalker::_socketsCount() {
 	if (_message_repeater) {
 		uint8_t countUplinkedSockets = _message_repeater->_uplinkedSocketsCount();
@@ -88,6 +214,23 @@ BroadcastSocket* JsonTalker::_getSocket(uint8_t socket_index) {
 }
 
 
+#ifndef TALKIE_NO_SYSTEM_STATS
+const RouteCounter* JsonTalker::_getRouteCounter(RouteValue route) const {
+	if (_message_repeater) {
+		return &_message_repeater->get_route_counter(route);
+	}
+	return nullptr;
+}
+
+
+void JsonTalker::_resetRouteCounters() const {
+	if (_message_repeater) {
+		_message_repeater->reset_route_counters();
+	}
+}
+#endif
+
+
 const char* JsonTalker::_manifesto_name() const {
 	if (_manifesto) {
 		return _manifesto->class_description();
@@ -97,13 +240,36 @@ const char* JsonTalker::_manifesto_name() const {
 
 
 void JsonTalker::_loop() {
-	if (_trace_message.active && (uint16_t)millis() - _trace_message.identity > TALKIE_TRACE_TTL) {
-		_trace_message.active = false;
+	if (_manifesto) _manifesto->_loop(*this);
+}
+
+
+uint32_t JsonTalker::_idleTime() const {
+	// The recovery TTL is a timer, so, already considered by the Repeater
+	if (_manifesto) {
+		return _manifesto->_idleTime(*this);
+	}
+	return TALKIE_IDLE_MAX_MS;
+}
+
+
+void JsonTalker::_onTimer(TalkieTimer& timer, void* talker) {
+	JsonTalker* self = static_cast<JsonTalker*>(talker);
+	#ifndef TALKIE_NO_RECOVERY
+	if (&timer == &self->_recovery_timer) {
+		self->_recovery_message.active = false;
+		return;
 	}
-	if (_recovery_message.active && (uint16_t)millis() - _recovery_message.transmitted_time > TALKIE_RECOVERY_TTL) {
-		_recovery_message.active = false;
+	#endif
+	#if TALKIE_PENDING_CALLS > 0
+	if (&timer == &self->_calls_timer) {
+		self->_expireCalls();
+		return;
+	}
+	#endif
+	if (self->_manifesto) {
+		self->_manifesto->_timer(*self, timer);
 	}
-	if (_manifesto) _manifesto->_loop(*this);
 }
 
 
@@ -122,6 +288,62 @@ const Action* JsonTalker::_getActionsArray() const {
 }
 
 
+void JsonTalker::_setActionPair(uint8_t index, JsonMessage& json_message) const {
+	if (_manifesto) {
+		_manifesto->_setActionPair(index, json_message);
+	}
+}
+
+
+void JsonTalker::_buildReplyCache() {
+	#if TALKIE_REPLY_CACHE > 0
+	_reply_cache_built = true;
+	JsonMessage fields;
+	const uint8_t total_actions = _actionsCount();
+	for (uint16_t entry = 0; entry <= total_actions; ++entry) {
+		fields.reset();
+		if (entry == 0) {
+			_setDescription(fields);
+		} else {
+			fields.set_nth_value_number(0, entry - 1);
+			_setActionPair(entry - 1, fields);
+		}
+		const size_t length = fields.get_length() - 2;	// Without the '{' and '}' chars
+		if (_reply_cache_length + 1 + length > TALKIE_REPLY_CACHE) break;	// The remaining ones aren't cached
+		_reply_cache[_reply_cache_length++] = (char)length;
+		memcpy(&_reply_cache[_reply_cache_length], fields._read_buffer() + 1, length);
+		_reply_cache_length += length;
+		++_reply_cache_entries;
+	}
+	#endif
+}
+
+
+bool JsonTalker::_setCachedReply(uint8_t entry, JsonMessage& json_message) {
+	#if TALKIE_REPLY_CACHE > 0
+	if (!_reply_cache_built) _buildReplyCache();
+	if (entry < _reply_cache_entries) {
+		uint16_t position = 0;
+		for (uint8_t entry_i = 0; entry_i < entry; ++entry_i) {
+			position += 1 + (uint8_t)_reply_cache[position];
+		}
+		// Makes sure the cached keys aren't present already
+		json_message.remove_nth_value(0);
+		if (entry > 0) {
+			json_message.remove_nth_value(1);
+			json_message.remove_nth_value(2);
+		}
+		const uint8_t length = (uint8_t)_reply_cache[position];
+		return json_message._append_fields(&_reply_cache[position + 1], length);
+	}
+	#else
+	(void)entry;		// Silence unused parameter warning
+	(void)json_message;	// Silence unused parameter warning
+	#endif
+	return false;
+}
+
+
 uint8_t JsonTalker::_actionIndex(const char* name) const {
 	if (_manifesto) {
 		return _manifesto->_actionIndex(name);
@@ -136,9 +358,16 @@ uint8_t JsonTalker::_actionIndex(uint8_t index) const {
 	return 255;
 }
 
-bool JsonTalker::_actionByIndex(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match) {
+bool JsonTalker::_checkArguments(uint8_t index, const JsonMessage::Arguments& arguments) const {
+	if (_manifesto) {
+		return _manifesto->_checkArguments(index, arguments);
+	}
+	return true;
+}
+
+bool JsonTalker::_actionByIndex(uint8_t index, JsonMessage& json_message, const JsonMessage::Arguments& arguments, TalkerMatch talker_match) {
 	if (_manifesto) {
-		return _manifesto->_actionByIndex(index, *this, json_message, talker_match);
+		return _manifesto->_actionByArguments(index, *this, json_message, arguments, talker_match);
 	}
 	return false;
 }
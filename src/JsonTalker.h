@@ -35,6 +35,7 @@ https://github.com/ruiseixasm/JsonTalkie
 
 #include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 #include "BroadcastSocket.h"
+#include "TalkieTimers.hpp"
 
 
 // #define JSON_TALKER_DEBUG
@@ -51,6 +52,8 @@ using MuteValue 		= TalkieCodes::MuteValue;
 using RogerValue 		= TalkieCodes::RogerValue;
 using ErrorValue 		= TalkieCodes::ErrorValue;
 using ValueType 		= TalkieCodes::ValueType;
+using RouteValue 		= TalkieCodes::RouteValue;
+using TimingValue 		= TalkieCodes::TimingValue;
 
 
 class TalkerManifesto;
@@ -73,45 +76,127 @@ public:
 	
 	struct TraceMessage {
 		uint16_t identity;
+		uint16_t sent_time;
 		MessageValue message_value;
 		bool active = false;
 	};
 
 	/**
-	 * @brief Represents an Action with a name and a description
+	 * @brief The completion token of a `call` whose echo is sent later by the Manifesto
+	 * 
+	 * It keeps just what is needed to rebuild the echo, so, a Manifesto can have
+	 * as many of them as the calls it's able to have pending.
+	 */
+	struct DeferredCall {
+		uint16_t identity;
+		char from[TALKIE_NAME_LEN];		// The caller, to whom the echo is sent
+		char action[TALKIE_NAME_LEN];	// Empty if called by index
+		uint8_t action_index;
+		BroadcastValue broadcast_value;
+		bool no_reply;
+		bool active = false;
+	};
+
+	/**
+	 * @brief The function called with the echo of a `call` request, or, with no echo when timed out
+	 * @param talker The Talker that sent the request
+	 * @param echo_message The echo with the results, or the error when the request was refused, nullptr if none arrived in time
+	 * @param round_trip_us The microseconds from the request until its echo (or timeout)
+	 * @param context Anything given to `call`, like the Manifesto that sent the request
+	 */
+	typedef void (*CallCallback)(JsonTalker& talker, const JsonMessage* echo_message, uint32_t round_trip_us, void* context);
+
+	/**
+	 * @brief Represents an Action with a name, a description and an optional arguments schema
 	 * 
 	 * An Action placed in a list has it's position matched with is
 	 * callable index number.
+	 * 
+	 * The schema has a char per value, `n` for a number, `s` for a string and `v` for any of both,
+	 * being optional if in uppercase, or, it's just `-` for no values at all. A `call` with values
+	 * not matching the schema is rejected with a TALKIE_ERR_VALUE error before reaching the Action.
 	 */
     struct Action {
         const char* name;
         const char* desc;
+        const char* args;	// The arguments schema, nullptr for none
+
+		constexpr Action(const char* name, const char* desc, const char* args = nullptr)
+			: name(name), desc(desc), args(args) {}
+    };
+
+	/**
+	 * @brief Represents an Action kept in flash (PROGMEM) with a name and a description
+	 * 
+	 * Its strings are arrays instead of pointers, so that the whole Action table goes
+	 * to flash, saving the RAM used by `Action` in AVR boards.
+	 */
+    struct FlashAction {
+        char name[TALKIE_NAME_LEN];
+        char desc[TALKIE_DESC_LEN];
+        char args[TALKIE_ARGS_LEN];	// The arguments schema, empty (omitted) for none
     };
 
 	
 private:
     
+	#ifndef TALKIE_NO_RECOVERY
 	struct RecoveryMessage {
 		uint16_t transmitted_time;
 		JsonMessage message;
 		bool active = false;
 	};
+	#endif
 
 	MessageRepeater* _message_repeater = nullptr;
 	LinkType _link_type = LinkType::TALKIE_LT_NONE;
 
     const char* _name;      // Name of the Talker
     const char* _desc;      // Description of the Device
+	const __FlashStringHelper* _flash_desc = nullptr;	// Description of the Device kept in flash
 	TalkerManifesto* _manifesto = nullptr;
     uint8_t _channel = 255;	// Channel 255 means NO channel response
+	bool _call_deferred = false;	// Set by `deferCall` while the Manifesto processes the call
     MuteValue _mute_value = MuteValue::TALKIE_MV_NONE;
-	TraceMessage _trace_message;
-	RecoveryMessage _recovery_message;
+	TraceMessage _trace_messages[TALKIE_TRACE_SIZE];	// The outstanding messages, oldest replaced first
+	uint8_t _trace_next = 0;
+	#ifndef TALKIE_NO_RECOVERY
+	RecoveryMessage _recovery_message;	// The last message sent by Socket, resent on a checksum error
+	TalkieTimer _recovery_timer;	// Ends the recovery after TALKIE_RECOVERY_TTL
+	#endif
 
 	uint16_t _count_rogers = 0;
 	uint16_t _count_negatives = 0;
 	uint16_t _count_says_again = 0;
 
+	#if TALKIE_ACTION_STATS > 0
+	ActionCounter _action_counters[TALKIE_ACTION_STATS];	// Of the first Actions only
+	#endif
+
+	#if TALKIE_PENDING_CALLS > 0
+	struct PendingCall {
+		uint16_t identity;
+		uint16_t timeout_ms;
+		uint32_t sent_us;
+		CallCallback callback;
+		void* context;
+		bool active = false;
+	};
+
+	PendingCall _pending_calls[TALKIE_PENDING_CALLS];	// The `call` requests waiting for their echoes
+	PendingCall* _sending_call = nullptr;	// Gets its identity from `_prepareMessage` before any echo arrives
+	TalkieTimer _calls_timer;	// Due with the earliest timeout of the pending calls
+	#endif
+
+	#if TALKIE_REPLY_CACHE > 0
+	// Each entry is a length byte followed by the serialized fields, being the entry 0 the `talk` reply
+	// and the entry i + 1 the `list` reply of the Action i, built once given that they never change
+	char _reply_cache[TALKIE_REPLY_CACHE];
+	uint16_t _reply_cache_length = 0;
+	uint8_t _reply_cache_entries = 0;
+	bool _reply_cache_built = false;
+	#endif
+
     enum CallCount : uint8_t {
         TALKIE_CC_ROGERS,
         TALKIE_CC_NEGATIVES,
@@ -161,6 +246,27 @@ private:
 	}
 
 
+	/**
+     * @brief Counts the result of a call of an Action
+     * @param action_i The index of the Action called
+     * @param roger The result of the call
+     */
+	void _countAction(uint8_t action_i, bool roger) {
+		#if TALKIE_ACTION_STATS > 0
+		if (action_i < TALKIE_ACTION_STATS) {
+			if (roger) {
+				_action_counters[action_i].rogers++;
+			} else {
+				_action_counters[action_i].negatives++;
+			}
+		}
+		#else
+		(void)action_i;
+		(void)roger;
+		#endif
+	}
+
+
 	/**
      * @brief Returns the description of the board where the Talker is being run on
      */
@@ -225,8 +331,10 @@ private:
      */
 	bool _prepareMessage(JsonMessage& json_message) {
 
+		#ifndef TALKIE_NO_RECOVERY
 		// It's a Recovery message, already prepared
 		if (&json_message == &_recovery_message.message) return true;	// It's a resend
+		#endif
 
 		MessageValue message_value = json_message.get_message_value();
 		if (message_value < MessageValue::TALKIE_MSG_ECHO) {	// Self Talker generated
@@ -237,13 +345,26 @@ private:
 			Serial.println();  // optional: just to add a newline after the JSON
 			#endif
 
-			uint16_t identity = (uint16_t)millis();
+			const uint16_t present_time = (uint16_t)millis();
+			uint16_t identity = present_time;
+			// Messages sent in the same millisecond still need different identities to match their echoes
+			while (_getTrace(identity) || _isPendingCall(identity)) ++identity;
 			if (!(json_message.set_from_name(_name) && json_message.set_identity(identity))) {
 				return false;	// Makes sure it can set MUST have fields
 			}
-			_trace_message.identity = identity;	// Faster this way
-			_trace_message.message_value = json_message.get_message_value();
-			_trace_message.active = true;
+			#if TALKIE_PENDING_CALLS > 0
+			if (_sending_call) {	// Set before sending, given that a local echo comes right away
+				_sending_call->identity = identity;
+				_sending_call->active = true;
+				_sending_call = nullptr;
+			}
+			#endif
+			TraceMessage& trace_message = _trace_messages[_trace_next];
+			_trace_next = (uint8_t)((_trace_next + 1) % TALKIE_TRACE_SIZE);
+			trace_message.identity = identity;	// Faster this way
+			trace_message.sent_time = present_time;
+			trace_message.message_value = message_value;
+			trace_message.active = true;
 
 		} else {	// errors and echoes responses, NOT Self Talker generated
 			
@@ -295,6 +416,20 @@ private:
 	BroadcastSocket* _getSocket(uint8_t socket_index);
 
 
+	#ifndef TALKIE_NO_SYSTEM_STATS
+	/**
+     * @brief Gets the Repeater counter of the given route
+     * @param route The route (ex. TALKIE_RT_SOCKET_DOWNLINK)
+     * @return Returns the RouteCounter pointer or nullptr if no Repeater
+     */
+	const RouteCounter* _getRouteCounter(RouteValue route) const;
+
+
+	/** @brief Resets the Repeater counters of all routes */
+	void _resetRouteCounters() const;
+	#endif
+
+
 	/** @brief Returns the class name of the manifesto */
 	const char* _manifesto_name() const;
 
@@ -307,6 +442,40 @@ private:
 	const Action* _getActionsArray() const;
 
 
+	/**
+     * @brief Sets the name and description of an Action as the values 1 and 2 of the message
+     * @param index The index of an existing Action
+     * @param json_message The `list` reply message
+     */
+	void _setActionPair(uint8_t index, JsonMessage& json_message) const;
+
+
+	/**
+     * @brief Sets the Talker description as the value 0 of the message
+     * @param json_message The `talk` reply message
+     */
+	void _setDescription(JsonMessage& json_message) const {
+		if (_flash_desc) {
+			json_message.set_nth_value_string(0, _flash_desc, TALKIE_MAX_LEN);
+		} else {
+			json_message.set_nth_value_string(0, _desc, TALKIE_MAX_LEN);
+		}
+	}
+
+
+	/** @brief Serializes once the `talk` and `list` replies into the cache, as many as fit in it */
+	void _buildReplyCache();
+
+
+	/**
+     * @brief Sets the cached `talk` or `list` reply fields with a single copy
+     * @param entry The entry 0 for `talk` and the entry i + 1 for the `list` of the Action i
+     * @param json_message The reply message
+     * @return false if the entry isn't cached, in which case the reply has to be set as usual
+     */
+	bool _setCachedReply(uint8_t entry, JsonMessage& json_message);
+
+
 	/**
      * @brief Returns the index Action for a given Action name
      * @param name The name of the Action
@@ -323,14 +492,24 @@ private:
 	uint8_t _actionIndex(uint8_t index) const;
 
 		
+    /**
+     * @brief Checks the values of a call against the arguments schema of the Action
+     * @param index The index of the Action being called
+     * @param arguments The decoded values of the call
+     * @return true if matching the schema or if the Action has none
+     */
+	bool _checkArguments(uint8_t index, const JsonMessage::Arguments& arguments) const;
+
+
     /**
      * @brief Calls a given Action by it's index number
      * @param index The index of the Action being called
      * @param json_message The json message made available for manipulation
+     * @param arguments The values of the message already decoded
      * @param talker_match The type of matching concerning the Talker call
      * @return Returns true if the call if successful (roger) or false if not (negative)
      */
-	bool _actionByIndex(uint8_t index, JsonMessage& json_message, TalkerMatch talker_match);
+	bool _actionByIndex(uint8_t index, JsonMessage& json_message, const JsonMessage::Arguments& arguments, TalkerMatch talker_match);
 
 
     /**
@@ -370,6 +549,14 @@ public:
         
     JsonTalker(const char* name, const char* desc, TalkerManifesto* manifesto = nullptr, uint8_t channel = 255)
         : _name(name), _desc(desc), _manifesto(manifesto), _channel(channel) {}
+        
+    /**
+     * @brief Constructor with a description kept in flash (PROGMEM), like `FPSTR(progmem_array)`
+     * 
+     * @note The name is kept in RAM because it's matched against every received message.
+     */
+    JsonTalker(const char* name, const __FlashStringHelper* desc, TalkerManifesto* manifesto = nullptr, uint8_t channel = 255)
+        : _name(name), _desc(nullptr), _flash_desc(desc), _manifesto(manifesto), _channel(channel) {}
 
 
 	/**
@@ -380,6 +567,76 @@ public:
     void _loop();
 
 
+	/**
+     * @brief Returns how long the Repeater can stay idle without calling the `_loop` method
+     * @return The idle time in milliseconds, bounded by the Manifesto `_idleTime`
+	 * 
+     * @note This method being underscored means to be called internally only.
+     */
+	uint32_t _idleTime() const;
+
+
+	/**
+     * @brief Gets the outstanding message with the given identity
+     * @param identity The identity of the message, the same of its echoes
+     * @return The traced message or nullptr if none or if older than `TALKIE_TRACE_TTL`
+     */
+	const TraceMessage* _getTrace(uint16_t identity) const {
+		const uint16_t present_time = (uint16_t)millis();
+		for (uint8_t trace_i = 0; trace_i < TALKIE_TRACE_SIZE; ++trace_i) {
+			const TraceMessage& trace_message = _trace_messages[trace_i];
+			if (trace_message.active && trace_message.identity == identity
+					&& (uint16_t)(present_time - trace_message.sent_time) <= TALKIE_TRACE_TTL) {
+				return &trace_message;
+			}
+		}
+		return nullptr;
+	}
+
+
+	/**
+     * @brief Checks if a `call` request with the given identity is still waiting for its echo
+     * @param identity The identity of the request, the same of its echo
+     * @return true if pending
+     */
+	bool _isPendingCall(uint16_t identity) const {
+		#if TALKIE_PENDING_CALLS > 0
+		for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+			if (_pending_calls[call_i].active && _pending_calls[call_i].identity == identity) return true;
+		}
+		#else
+		(void)identity;
+		#endif
+		return false;
+	}
+
+
+	#if TALKIE_PENDING_CALLS > 0
+
+	/**
+     * @brief Calls back the pending `call` request answered by the given echo
+     * @param echo_message The echo received
+     * @return true if it was the echo of a pending call, which is then done
+     */
+	bool _answerCall(const JsonMessage& echo_message);
+
+
+	/**
+     * @brief Calls back the pending `call` requests already timed out and rearms the calls timer
+     */
+	void _expireCalls();
+
+	#endif
+
+
+	/**
+     * @brief The callback of all the Talker timers, including the ones of its Manifesto
+     * @param timer The due timer
+     * @param talker The Talker that started the timer
+     */
+	static void _onTimer(TalkieTimer& timer, void* talker);
+
+
     // ============================================
     // GETTERS - FIELD VALUES
     // ============================================
@@ -398,6 +655,13 @@ public:
 	const char* get_desc() const { return _desc; }
 
 	
+    /**
+	 * @brief Get the description of the Talker kept in flash
+	 * @return A pointer to the Talker flash description or nullptr if kept in RAM
+     */
+	const __FlashStringHelper* get_flash_desc() const { return _flash_desc; }
+
+	
     /**
      * @brief Get the channel of the Talker
      * @return The channel number of the Talker
@@ -433,9 +697,11 @@ public:
      * @brief Get the last transmitted non echo message
      * @return Returns `TraceMessage` with the message id and value
      * 
-     * @note This is used to pair the message id with its echo
+     * @note Up to `TALKIE_TRACE_SIZE` outstanding messages are paired with their echoes
      */
-    const TraceMessage& getTraceMessage() const { return _trace_message; }
+    const TraceMessage& getTraceMessage() const {
+		return _trace_messages[(_trace_next + TALKIE_TRACE_SIZE - 1) % TALKIE_TRACE_SIZE];
+	}
 
 
     // ============================================
@@ -474,6 +740,86 @@ public:
      * @note This method sends directly to the Repeater as talker
      */
 	bool transmitToRepeater(JsonMessage& json_message);
+
+
+    /**
+     * @brief Starts (or restarts) a timer that calls the Manifesto `_timer` method when due
+     * @param timer The timer, typically a Manifesto member
+     * @param delay_ms The time in milliseconds from now until it's due
+     * @param period_ms The period in milliseconds to be due again, 0 for a one-shot timer
+     * 
+     * @note Instead of checking `millis()` in each `_loop` call, only the due timers are run.
+     */
+	void startTimer(TalkieTimer& timer, uint32_t delay_ms, uint32_t period_ms = 0) {
+		TimerWheel::instance().start(timer, delay_ms, period_ms, _onTimer, this);
+	}
+
+
+    /**
+     * @brief Stops a timer started with `startTimer`, if pending
+     * @param timer The timer to be stopped
+     */
+	void stopTimer(TalkieTimer& timer) {
+		TimerWheel::instance().stop(timer);
+	}
+
+
+    /**
+     * @brief Defers the echo of the `call` being processed, so that no echo is sent right away
+     * @param json_message The `call` message given to the Manifesto `_actionByIndex` method
+     * @param deferred_call The completion token kept by the Manifesto until the call is done
+     * @return true if deferred, in which case `_actionByIndex` shall return true too
+     * 
+     * @note Intended to be called from the Manifesto `_actionByIndex` method only.
+     */
+	bool deferCall(const JsonMessage& json_message, DeferredCall& deferred_call);
+
+
+    /**
+     * @brief Sends the echo of a deferred `call` with its original identity
+     * @param deferred_call The completion token given to `deferCall`
+     * @param json_message A new message with just the values of the result, if any
+     * @param roger The result of the call, false results in a `negative` roger
+     * @return true if successfully sent via Socket
+     * 
+     * @note Typically called from the Manifesto `_loop` method once the call is done.
+     */
+	bool completeCall(DeferredCall& deferred_call, const JsonMessage& json_message, bool roger = true);
+
+
+	#if TALKIE_PENDING_CALLS > 0
+
+    /**
+     * @brief Sends a `call` request whose echo, or timeout, is given to the callback
+     * @param target The name of the called Talker
+     * @param action The name of the called Action
+     * @param json_message A new message with just the values of the arguments, if any
+     * @param callback The function called once with the echo, or the error, or, with nullptr when timed out
+     * @param context Anything given to the callback
+     * @param timeout_ms The time waiting for the echo
+     * @param broadcast_value LOCAL for the Talkers of the same Repeater, REMOTE for the ones beyond
+     * @return true if the request was sent and is pending, false if all `TALKIE_PENDING_CALLS` are pending
+     * 
+     * @note Many requests can be pending at once, each one matched with its echo by identity.
+     */
+	bool call(const char* target, const char* action, const JsonMessage& json_message,
+		CallCallback callback, void* context = nullptr, uint16_t timeout_ms = TALKIE_CALL_TIMEOUT,
+		BroadcastValue broadcast_value = BroadcastValue::TALKIE_BC_LOCAL);
+
+
+    /**
+     * @brief Get the amount of `call` requests waiting for their echoes
+     * @return The pending calls
+     */
+	uint8_t get_pending_calls() const {
+		uint8_t pending_calls = 0;
+		for (uint8_t call_i = 0; call_i < TALKIE_PENDING_CALLS; ++call_i) {
+			if (_pending_calls[call_i].active) ++pending_calls;
+		}
+		return pending_calls;
+	}
+
+	#endif
 	
 
     /**
@@ -518,12 +864,38 @@ public:
 							Serial.println(F(", now being processed..."));
 							#endif
 
+							// Decoded once for both the schema and the Action
+							JsonMessage::Arguments arguments;
+							json_message.decode_arguments(arguments);
+							if (!_checkArguments(index_found_i, arguments)) {
+								_increment_call_count(TALKIE_CC_SAYS_AGAIN);
+								json_message.set_message_value(MessageValue::TALKIE_MSG_ERROR);
+								json_message.set_error_value(ErrorValue::TALKIE_ERR_VALUE);
+								transmitToRepeater(json_message);	// Errors are only muted with all
+								break;
+							}
+
+							#if TALKIE_ACTION_STATS > 0
+							const uint32_t start_us = micros();
+							#endif
 							// ROGER should be implicit for CALL to spare json string size for more data index value nth
-							if (!_actionByIndex(index_found_i, json_message, talker_match)) {
+							const bool roger = _actionByIndex(index_found_i, json_message, arguments, talker_match);
+							#if TALKIE_ACTION_STATS > 0
+							if (index_found_i < TALKIE_ACTION_STATS) {
+								_action_counters[index_found_i].timing.add(micros() - start_us);
+							}
+							#endif
+							if (!roger) {
+								_call_deferred = false;
 								_increment_call_count(TALKIE_CC_NEGATIVES);
+								_countAction(index_found_i, false);
 								json_message.set_roger_value(RogerValue::TALKIE_RGR_NEGATIVE);
+							} else if (_call_deferred) {
+								_call_deferred = false;
+								break;	// The echo is sent later by `completeCall`
 							} else {
 								_increment_call_count(TALKIE_CC_ROGERS);
+								_countAction(index_found_i, true);
 							}
 						} else {
 							_increment_call_count(TALKIE_CC_SAYS_AGAIN);
@@ -537,13 +909,18 @@ public:
 				}
 				break;
 			
+			#ifndef TALKIE_NO_TALK
 			case MessageValue::TALKIE_MSG_TALK:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
-				json_message.set_nth_value_string(0, _desc, TALKIE_MAX_LEN);
+				if (!_setCachedReply(0, json_message)) {
+					_setDescription(json_message);
+				}
 				// In the end sends back the processed message (single message, one-to-one)
 				transmitToRepeater(json_message);
 				break;
+			#endif
 			
+			#ifndef TALKIE_NO_CHANNEL
 			case MessageValue::TALKIE_MSG_CHANNEL:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
 				if (!json_message.get_nth_value_number(0, &_channel)) {
@@ -553,6 +930,7 @@ public:
 				// In the end sends back the processed message (single message, one-to-one)
 				transmitToRepeater(json_message);
 				break;
+			#endif
 			
 			case MessageValue::TALKIE_MSG_PING:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
@@ -560,11 +938,11 @@ public:
 				transmitToRepeater(json_message);
 				break;
 			
+			#ifndef TALKIE_NO_LIST
 			case MessageValue::TALKIE_MSG_LIST:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
 				if (_manifesto) {
 					
-					const Action* actions = _getActionsArray();
 					if (json_message.has_action()) {
 						uint8_t index_found_i = json_message.get_action_index();	// returns 255 if not found
 
@@ -578,9 +956,10 @@ public:
 						}
 						json_message.remove_action();
 						if (index_found_i < 255) {
-							json_message.set_nth_value_number(0, index_found_i);
-							json_message.set_nth_value_string(1, actions[index_found_i].name, TALKIE_NAME_LEN);
-							json_message.set_nth_value_string(2, actions[index_found_i].desc, TALKIE_MAX_LEN);
+							if (!_setCachedReply(index_found_i + 1, json_message)) {
+								json_message.set_nth_value_number(0, index_found_i);
+								_setActionPair(index_found_i, json_message);
+							}
 						} else {
 							json_message.set_roger_value(RogerValue::TALKIE_RGR_SAY_AGAIN);
 						}
@@ -589,9 +968,10 @@ public:
 						uint8_t total_actions = _actionsCount();	// This makes the access safe
 						for (uint8_t action_i = 0; action_i < total_actions; ++action_i) {
 							
-							json_message.set_nth_value_number(0, action_i);
-							json_message.set_nth_value_string(1, actions[action_i].name, TALKIE_NAME_LEN);
-							json_message.set_nth_value_string(2, actions[action_i].desc, TALKIE_MAX_LEN);
+							if (!_setCachedReply(action_i + 1, json_message)) {
+								json_message.set_nth_value_number(0, action_i);
+								_setActionPair(action_i, json_message);
+							}
 							transmitToRepeater(json_message);	// Many-to-One
 							json_message.remove_all_nth_values();	// Makes sure there is space for each new action
 						}
@@ -605,7 +985,9 @@ public:
 					transmitToRepeater(json_message);		// One-to-One
 				}
 				break;
+			#endif
 			
+			#ifndef TALKIE_NO_SYSTEM
 			case MessageValue::TALKIE_MSG_SYSTEM:
 				json_message.set_message_value(MessageValue::TALKIE_MSG_ECHO);
 				if (json_message.has_system()) {
@@ -689,6 +1071,7 @@ public:
 							}
 							break;
 
+						#ifndef TALKIE_NO_SYSTEM_STATS
 						case SystemValue::TALKIE_SYS_ERRORS:
 							{
 								uint8_t sockets_count = _socketsCount();
@@ -716,10 +1099,43 @@ public:
 							{
 								if (_manifesto) {
 
+									// Like traffic and errors, any first value resets the counters, while the page is the second value
 									if (json_message.has_nth_value_number(0)) {
 										_count_rogers = 0;
 										_count_negatives = 0;
 										_count_says_again = 0;
+										#if TALKIE_ACTION_STATS > 0
+										for (ActionCounter& action_counter : _action_counters) {
+											action_counter.reset();
+										}
+										#endif
+									}
+
+									uint8_t page;
+									if (json_message.get_nth_value_number(1, &page)) {
+										#if TALKIE_ACTION_STATS > 0
+										const uint8_t actions_count = _actionsCount() < TALKIE_ACTION_STATS ? _actionsCount() : TALKIE_ACTION_STATS;
+										const uint16_t first_action = (uint16_t)page * TALKIE_STATS_PAGE;
+										for (uint16_t action_i = first_action; action_i < actions_count && action_i < first_action + TALKIE_STATS_PAGE; ++action_i) {
+											const ActionCounter& action_counter = _action_counters[action_i];
+											// Like the timing, the action index and the counted kind share the same field (ex. 31 for action 3 time)
+											// {"m":7,"s":6,"b":1,"i":12345,"f":"","t":"","0":2541,"1":4294967295,"2":4294967295,"3":4294967295,"c":12345} <-- 128 - (105 + 2*10) = 3 (>= 0 OK!)
+											json_message.set_nth_value_number(0, (uint32_t)action_i * 10);
+											json_message.set_nth_value_number(1, action_counter.timing.samples);
+											json_message.set_nth_value_number(2, action_counter.rogers);
+											json_message.set_nth_value_number(3, action_counter.negatives);
+											transmitToRepeater(json_message);	// Many-to-One
+											json_message.set_nth_value_number(0, (uint32_t)action_i * 10 + 1);
+											json_message.set_nth_value_number(1, action_counter.timing.total_us);
+											json_message.set_nth_value_number(2, action_counter.timing.max_us);
+											json_message.remove_nth_value(3);
+											transmitToRepeater(json_message);	// Many-to-One
+										}
+										if (first_action < actions_count) return;	// All transmissions already done by the loop above
+										#endif
+										json_message.remove_all_nth_values();
+										json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);	// No more pages
+										break;
 									}
 
 									const uint32_t total_calls =
@@ -736,6 +1152,79 @@ public:
 							}
 							break;
 
+						case SystemValue::TALKIE_SYS_TRAFFIC:
+							{
+								const bool reset_counters = json_message.has_nth_value_number(0);
+								uint8_t sockets_count = _socketsCount();
+								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
+									
+									BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
+									if (reset_counters) socket->reset_counters();
+									json_message.set_nth_value_number(0, socket_i);
+									// {"m":7,"s":7,"b":1,"i":12345,"f":"","t":"","0":255,"1":4294967295,"2":4294967295,"3":4294967295,"c":12345} <-- 128 - (106 + 2*10) = 2 (>= 0 OK!)
+									json_message.set_nth_value_number(1, socket->get_messages_in());
+									json_message.set_nth_value_number(2, socket->get_messages_out());
+									json_message.set_nth_value_number(3, socket->get_bytes_sent());
+					
+									transmitToRepeater(json_message);	// Many-to-One
+								}
+								if (!sockets_count) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								} else {
+									return;	// All transmissions already done by the if condition above
+								}
+							}
+							break;
+
+						case SystemValue::TALKIE_SYS_ROUTES:
+							{
+								if (json_message.has_nth_value_number(0)) {
+									_resetRouteCounters();
+								}
+								for (uint8_t route_i = 0; route_i <= RouteValue::TALKIE_RT_TALKER_DOWNLINK; ++route_i) {
+									const RouteCounter* route_counter = _getRouteCounter(static_cast<RouteValue>(route_i));
+									if (!route_counter) break;
+									json_message.set_nth_value_number(0, route_i);
+									json_message.set_nth_value_number(1, route_counter->messages);
+									json_message.set_nth_value_number(2, route_counter->deliveries);
+									transmitToRepeater(json_message);	// Many-to-One
+								}
+								if (!_message_repeater) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								} else {
+									return;	// All transmissions already done by the if condition above
+								}
+							}
+							break;
+
+						case SystemValue::TALKIE_SYS_TIMING:
+							{
+								const bool reset_counters = json_message.has_nth_value_number(0);
+								uint8_t sockets_count = _socketsCount();
+								for (uint8_t socket_i = 0; socket_i < sockets_count; ++socket_i) {
+									
+									BroadcastSocket* socket = _getSocket(socket_i);	// Safe sockets_count already
+									if (reset_counters) socket->reset_counters();
+									for (uint8_t timing_i = 0; timing_i <= TimingValue::TALKIE_TM_SEND; ++timing_i) {
+										const TimingCounter& timing = socket->get_timing(static_cast<TimingValue>(timing_i));
+										// Like the link pair, the socket index and the timing value share the same field (ex. 12 for socket 1 routing)
+										// {"m":7,"s":9,"b":1,"i":12345,"f":"","t":"","0":2553,"1":4294967295,"2":4294967295,"3":4294967295,"c":12345} <-- 128 - (107 + 2*10) = 1 (>= 0 OK!)
+										json_message.set_nth_value_number(0, (uint32_t)socket_i * 10 + timing_i);
+										json_message.set_nth_value_number(1, timing.total_us);
+										json_message.set_nth_value_number(2, timing.max_us);
+										json_message.set_nth_value_number(3, timing.samples);
+										transmitToRepeater(json_message);	// Many-to-One
+									}
+								}
+								if (!sockets_count) {
+									json_message.set_roger_value(RogerValue::TALKIE_RGR_NO_JOY);
+								} else {
+									return;	// All transmissions already done by the if condition above
+								}
+							}
+							break;
+						#endif
+
 						default: break;
 					}
 
@@ -743,9 +1232,14 @@ public:
 					transmitToRepeater(json_message);
 				}
 				break;
+			#endif
 			
 			case MessageValue::TALKIE_MSG_ECHO:
-				if (_manifesto && talker_match == TalkerMatch::TALKIE_MATCH_BY_NAME) {	// It's for me
+				if (talker_match == TalkerMatch::TALKIE_MATCH_BY_NAME) {	// It's for me
+
+					#if TALKIE_PENDING_CALLS > 0
+					if (_answerCall(json_message)) break;	// The echo of a `call` request goes to its callback
+					#endif
 
 					// Makes sure it has the same id first (echo match condition)
 					uint16_t echo_message_id = json_message.get_identity();
@@ -756,20 +1250,22 @@ public:
 					Serial.print(" | ");
 					Serial.print(echo_message_id);
 					Serial.print(" | ");
-					Serial.print(_trace_message.identity);
+					Serial.print(getTraceMessage().identity);
 					Serial.print(" | ");
 					Serial.println(_name);
 					#endif
 
-					if (echo_message_id == _trace_message.identity) {
-						_echo(json_message, _trace_message.message_value, talker_match);
+					// Kept until its TTL given that a message to a channel has many echoes
+					const TraceMessage* trace_message = _getTrace(echo_message_id);
+					if (trace_message) {
+						_echo(json_message, trace_message->message_value, talker_match);
 					}
 				}
 				break;
 			
 			case MessageValue::TALKIE_MSG_ERROR:
 				{					
-					#ifdef JSON_TALKER_DEBUG_CHECKSUM
+					#if defined(JSON_TALKER_DEBUG_CHECKSUM) && !defined(TALKIE_NO_RECOVERY)
 					Serial.print(F("\t\t\thandleTransmission2.1 (ERROR): "));
 					json_message.write_to(Serial);
 					Serial.print(" | ");
@@ -783,6 +1279,7 @@ public:
 					ErrorValue error_value = json_message.get_error_value();
 					switch (error_value) {
 
+						#ifndef TALKIE_NO_RECOVERY
 						case ErrorValue::TALKIE_ERR_CHECKSUM:
 						
 							if (_recovery_message.active) {
@@ -809,9 +1306,16 @@ public:
 								transmitToRepeater(_recovery_message.message);
 							}
 							break;
+						#endif
 						
 						default: break;
 					}
+					#if TALKIE_PENDING_CALLS > 0
+					// A refused `call` request (ex. arguments not matching the schema) is answered right away too,
+					// while a corrupted one is resent above and keeps waiting for its echo
+					if (error_value != ErrorValue::TALKIE_ERR_CHECKSUM && talker_match == TalkerMatch::TALKIE_MATCH_BY_NAME
+						&& _answerCall(json_message)) break;
+					#endif
 					// Always send error messages to the User Manifesto
 					_error(json_message, error_value, talker_match);
 				}
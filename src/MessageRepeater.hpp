@@ -30,6 +30,16 @@ https://github.com/ruiseixasm/JsonTalkie
 #include "BroadcastSocket.h"
 #include "JsonTalker.h"
 
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 // #define MESSAGE_REPEATER_DEBUG
 
 using LinkType			= TalkieCodes::LinkType;
@@ -41,6 +51,7 @@ using MuteValue 		= TalkieCodes::MuteValue;
 using RogerValue 		= TalkieCodes::RogerValue;
 using ErrorValue 		= TalkieCodes::ErrorValue;
 using ValueType 		= TalkieCodes::ValueType;
+using RouteValue 		= TalkieCodes::RouteValue;
 
 
 /**
@@ -63,6 +74,232 @@ private:
 	JsonTalker* const* const _uplinked_talkers;
 	const uint8_t _uplinked_talkers_count;
 	
+	mutable volatile bool _wake_up = false;
+	mutable uint16_t _duplicates_count = 0;
+	#ifndef TALKIE_NO_SYSTEM_STATS
+	mutable RouteCounter _routes[TalkieCodes::TALKIE_RT_TALKER_DOWNLINK + 1];	///< Indexed by `RouteValue`
+	#endif
+	#if TALKIE_DEDUP_SIZE > 0
+	mutable uint32_t _dedup_keys[TALKIE_DEDUP_SIZE] = {0};	///< Identity (high 16 bits) and content checksum (low 16 bits)
+	mutable uint16_t _dedup_times[TALKIE_DEDUP_SIZE] = {0};
+	mutable uint8_t _dedup_next = 0;
+	#endif
+	#ifdef ESP32
+	mutable TaskHandle_t _idle_task = nullptr;
+	mutable TaskHandle_t _io_task = nullptr;	///< Only set in dual core mode
+
+
+	/**
+     * @brief The I/O task body in dual core mode, it only receives and sends via Sockets
+     * @param message_repeater The Message Repeater pointer
+     */
+	static void _ioTask(void* message_repeater) {
+		const MessageRepeater* repeater = static_cast<const MessageRepeater*>(message_repeater);
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);	// Waits for all Sockets being set by `beginDualCore`
+		for (;;) {
+			repeater->_ioLoop();
+		}
+	}
+
+
+	/** @brief One pass of the I/O task, waits for the Sockets or the routing core when idle */
+	void _ioLoop() const {
+		uint32_t idle_time = TALKIE_IDLE_MAX_MS;
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+			_uplinked_sockets[socket_j]->_ioLoop();
+			const uint32_t socket_idle_time = _uplinked_sockets[socket_j]->_idleTime();
+			if (socket_idle_time < idle_time) idle_time = socket_idle_time;
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+			_downlinked_sockets[socket_j]->_ioLoop();
+			const uint32_t socket_idle_time = _downlinked_sockets[socket_j]->_idleTime();
+			if (socket_idle_time < idle_time) idle_time = socket_idle_time;
+		}
+		if (idle_time > 0) {
+			// At least one tick, otherwise the lower priority tasks of this core starve (watchdog)
+			const TickType_t idle_ticks = pdMS_TO_TICKS(idle_time);
+			ulTaskNotifyTake(pdTRUE, idle_ticks > 0 ? idle_ticks : 1);
+		}
+	}
+	#endif
+	#ifdef __linux__
+	mutable int _epoll_fd = -1;		///< Only set by `beginEpoll`
+	mutable int _wake_fd = -1;		///< The `eventfd` written by `_wakeUp`
+
+
+	/**
+     * @brief Waits with `epoll` for readable Sockets, marking them to be received in their next `_loop`
+     * @param timeout_ms The maximum time to wait in milliseconds, `0` to just check
+     */
+	void _pollReady(uint32_t timeout_ms) const {
+		epoll_event events[TALKIE_EPOLL_EVENTS];
+		const int ready = epoll_wait(_epoll_fd, events, TALKIE_EPOLL_EVENTS, (int)timeout_ms);
+		for (int event_i = 0; event_i < ready; ++event_i) {
+			BroadcastSocket* socket = static_cast<BroadcastSocket*>(events[event_i].data.ptr);
+			if (socket) {
+				socket->_setReady();
+			} else {	// Woken up by `_wakeUp`
+				uint64_t wake_ups;
+				if (read(_wake_fd, &wake_ups, sizeof(wake_ups)) < 0) {
+					// Already read, nothing to do
+				}
+			}
+		}
+	}
+
+
+	/** @brief Registers the Socket file descriptor, if any, to be waited for by `epoll` */
+	bool _registerSocket(BroadcastSocket* socket) const {
+		const int socket_fd = socket->_eventFd();
+		if (socket_fd < 0) {	// Polled as usual
+			socket->_setReadinessDriven(false);
+			return true;
+		}
+		epoll_event event = {};
+		event.events = EPOLLIN;
+		event.data.ptr = socket;
+		// A closed file descriptor leaves the epoll set by itself, so, only the same open one already exists
+		if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, socket_fd, &event) != 0 && errno != EEXIST) {
+			socket->_setReadinessDriven(false);
+			return false;
+		}
+		socket->_setReadinessDriven(true);
+		return true;
+	}
+	#endif
+
+
+	/** @brief Loops the Socket, or in dual core mode, routes what the I/O task received */
+	void _socketLoop(BroadcastSocket* socket) const {
+		#ifdef ESP32
+		if (_io_task) {
+			socket->_routeLoop();
+			return;
+		}
+		#endif
+		socket->_loop();
+	}
+
+
+	/** @brief The Socket idle time as seen by the Repeater loop */
+	uint32_t _socketIdleTime(const BroadcastSocket* socket) const {
+		#ifdef ESP32
+		if (_io_task) return socket->_routeIdleTime();
+		#endif
+		return socket->_idleTime();
+	}
+
+
+	/**
+     * @brief Waits for a Socket event or for the given time to elapse, whatever happens first
+     * @param idle_time The maximum time to wait in milliseconds
+	 * 
+     * @note In ESP32 the task is blocked (notified by `_wakeUp`), in AVR the CPU is put in idle
+	 *       sleep mode (woken up by any interrupt), in Linux after `beginEpoll` the thread sleeps
+	 *       in `epoll_wait`, otherwise it just yields.
+     */
+	void _waitEvent(uint32_t idle_time) const {
+		#ifdef ESP32
+		_idle_task = xTaskGetCurrentTaskHandle();
+		if (!_wake_up) {
+			ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idle_time));
+		}
+		#else
+		#ifdef __linux__
+		if (_epoll_fd >= 0) {
+			if (!_wake_up) _pollReady(idle_time);
+			_wake_up = false;
+			return;
+		}
+		#endif
+		const unsigned long start_time = millis();
+		while (!_wake_up && millis() - start_time < idle_time && _idleTime() > 0) {
+			#ifdef __AVR__
+			set_sleep_mode(SLEEP_MODE_IDLE);
+			noInterrupts();
+			if (!_wake_up) {
+				sleep_enable();
+				interrupts();	// The instruction following sei() is always executed, so, no event is missed
+				sleep_cpu();
+				sleep_disable();
+			}
+			interrupts();
+			#else
+			yield();
+			#endif
+		}
+		#endif
+		_wake_up = false;
+	}
+
+
+	/**
+     * @brief Takes the hop count out of a message received by a Socket and checks if it was already routed
+     * @param message A json message received by a Socket, left without the hop count ('h')
+     * @param hop_count Returns the Socket to Socket hops left to the message
+     * @return false if it's a duplicate that shall be dropped
+	 * 
+     * @note Duplicates happen when the same message reaches the Repeater by more than one path,
+	 *       recovery and error messages are never considered duplicates because they are retried.
+     */
+	bool _admitMessage(JsonMessage &message, uint8_t* hop_count) const {
+		*hop_count = message.get_hop_count();
+		message.remove_hop_count();
+		#if TALKIE_DEDUP_SIZE > 0
+		if (message.is_recover_message() || message.get_message_value() == MessageValue::TALKIE_MSG_ERROR) {
+			return true;
+		}
+		const uint32_t message_key = (uint32_t)message.get_identity() << 16 | message.generate_checksum();
+		const uint16_t present_time = (uint16_t)millis();
+		for (uint8_t key_i = 0; key_i < TALKIE_DEDUP_SIZE; ++key_i) {
+			if (_dedup_keys[key_i] == message_key && (uint16_t)(present_time - _dedup_times[key_i]) < TALKIE_DEDUP_TTL) {
+				++_duplicates_count;
+				return false;
+			}
+		}
+		_dedup_keys[_dedup_next] = message_key;
+		_dedup_times[_dedup_next] = present_time;
+		_dedup_next = (uint8_t)((_dedup_next + 1) % TALKIE_DEDUP_SIZE);
+		#endif
+		return true;
+	}
+
+
+	/**
+     * @brief Spends one hop of a message about to be forwarded from a Socket to other Sockets
+     * @param message A json message received by a Socket
+     * @param hop_count The hops left to the message as returned by `_admitMessage`
+     * @return false if no hops are left, or no room for the hop count ('h'), and thus the message shall stay local
+	 * 
+     * @note Without the hop count the next Repeater would take the message as never forwarded.
+     */
+	bool _spendHop(JsonMessage &message, uint8_t hop_count) const {
+		if (hop_count == 0) return false;
+		return message.set_hop_count(hop_count - 1);
+	}
+
+
+	/** @brief Delivers a message to a Talker while counting it for the given route */
+	void _deliver(RouteValue route, JsonTalker* talker, JsonMessage &message, TalkerMatch talker_match) const {
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[route].deliveries;
+		#else
+		(void)route;		// Silence unused parameter warning
+		#endif
+		talker->handleTransmission(message, talker_match);
+	}
+
+
+	/** @brief Delivers a message to a Socket while counting it for the given route */
+	bool _deliver(RouteValue route, BroadcastSocket* socket, JsonMessage &message) const {
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[route].deliveries;
+		#else
+		(void)route;		// Silence unused parameter warning
+		#endif
+		return socket->_finishTransmission(message);
+	}
+
 
 public:
 
@@ -93,7 +330,19 @@ public:
 	}
 
 	~MessageRepeater() {
-		// Does nothing
+		#ifdef __linux__
+		// The Sockets may outlive the Repeater, like singletons closed at exit
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+			_uplinked_sockets[socket_j]->_setLink(nullptr, LinkType::TALKIE_LT_NONE);
+			_uplinked_sockets[socket_j]->_setReadinessDriven(false);
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+			_downlinked_sockets[socket_j]->_setLink(nullptr, LinkType::TALKIE_LT_NONE);
+			_downlinked_sockets[socket_j]->_setReadinessDriven(false);
+		}
+		if (_epoll_fd >= 0) close(_epoll_fd);
+		if (_wake_fd >= 0) close(_wake_fd);
+		#endif
 	}
 
 
@@ -110,14 +359,18 @@ public:
 	 * ```
 	 */
     void loop() const {
+		TimerWheel::instance()._advance(millis());	// Runs the due timers of all Talkers
+		#ifdef __linux__
+		if (_epoll_fd >= 0) _pollReady(0);	// Marks the readable Sockets, the others aren't received
+		#endif
 		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
-			_uplinked_sockets[socket_j]->_loop();
+			_socketLoop(_uplinked_sockets[socket_j]);
 		}
 		for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
 			_downlinked_talkers[talker_i]->_loop();
 		}
 		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
-			_downlinked_sockets[socket_j]->_loop();
+			_socketLoop(_downlinked_sockets[socket_j]);
 		}
 		for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 			_uplinked_talkers[talker_i]->_loop();
@@ -125,6 +378,230 @@ public:
     }
 
 
+	/**
+	 * @brief Alternative to the `loop()` method that lets the board idle while there is nothing to do
+	 * @param max_idle_time The maximum time in milliseconds to stay idle
+	 *
+	 * After a `loop()` pass, waits until a Socket signals received data or the earliest
+	 * Talker timing is due, whatever comes first.
+	 * Example:
+	 * ```
+	 * void loop() {
+	 *     message_repeater.idleLoop();
+	 * }
+	 * ```
+	 * @note Sockets that can't signal or check for data are polled every `TALKIE_POLL_INTERVAL_MS`.
+	 */
+	void idleLoop(uint32_t max_idle_time = TALKIE_IDLE_MAX_MS) const {
+		loop();
+		uint32_t idle_time = _idleTime();
+		if (idle_time > max_idle_time) idle_time = max_idle_time;
+		if (idle_time > 0) {
+			_waitEvent(idle_time);
+		}
+	}
+
+
+	/**
+     * @brief Returns how long the Repeater can stay idle, the earliest of all timers, Sockets and Talkers
+     * @return The idle time in milliseconds, where `0` means there is work to be done
+	 * 
+     * @note This is intended to be called internally and not by the user code.
+     */
+	uint32_t _idleTime() const {
+		uint32_t idle_time = TimerWheel::instance()._idleTime(millis());
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count && idle_time > 0; ++socket_j) {
+			const uint32_t socket_idle_time = _socketIdleTime(_uplinked_sockets[socket_j]);
+			if (socket_idle_time < idle_time) idle_time = socket_idle_time;
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count && idle_time > 0; ++socket_j) {
+			const uint32_t socket_idle_time = _socketIdleTime(_downlinked_sockets[socket_j]);
+			if (socket_idle_time < idle_time) idle_time = socket_idle_time;
+		}
+		for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count && idle_time > 0; ++talker_i) {
+			const uint32_t talker_idle_time = _downlinked_talkers[talker_i]->_idleTime();
+			if (talker_idle_time < idle_time) idle_time = talker_idle_time;
+		}
+		for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count && idle_time > 0; ++talker_i) {
+			const uint32_t talker_idle_time = _uplinked_talkers[talker_i]->_idleTime();
+			if (talker_idle_time < idle_time) idle_time = talker_idle_time;
+		}
+		return idle_time;
+	}
+
+
+	#ifdef __linux__
+
+	/**
+     * @brief Registers again a Socket whose file descriptor changed, like when reopened by its `begin`
+     * @param socket The Socket with the new file descriptor, `-1` if closed
+	 * 
+     * @note This method is called by the Socket `_eventFdChanged` method.
+     */
+	void _reregisterSocket(BroadcastSocket* socket) const {
+		if (_epoll_fd >= 0) _registerSocket(socket);
+	}
+
+	#endif
+
+
+	/**
+     * @brief Wakes up the Repeater if waiting in its `idleLoop` method
+	 * 
+     * @note This method is ISR safe and is called by the Socket `_signalEvent` method.
+     */
+	void _wakeUp() const {
+		_wake_up = true;
+		#ifdef ESP32
+		if (_idle_task) {
+			_notifyTask(_idle_task);
+		}
+		#endif
+		#ifdef __linux__
+		if (_wake_fd >= 0) {
+			const uint64_t wake_up = 1;
+			if (write(_wake_fd, &wake_up, sizeof(wake_up)) < 0) {
+				// Already signaled, nothing to do
+			}
+		}
+		#endif
+	}
+
+
+	/**
+     * @brief Get the amount of duplicated messages dropped by the Repeater
+     * @return Returns the number of duplicates
+	 * 
+     * @note Duplicates only happen in networks with more than one path between Repeaters.
+     */
+	uint16_t get_duplicates_count() const { return _duplicates_count; }
+
+
+	/**
+     * @brief Get the messages and deliveries of a given route
+     * @param route The route (ex. TALKIE_RT_SOCKET_DOWNLINK)
+     * @return Returns the route counter
+     */
+	#ifndef TALKIE_NO_SYSTEM_STATS
+	const RouteCounter& get_route_counter(RouteValue route) const {
+		return _routes[route <= RouteValue::TALKIE_RT_TALKER_DOWNLINK ? route : RouteValue::TALKIE_RT_TALKER_DOWNLINK];
+	}
+
+
+	/** @brief Resets the counters of all routes */
+	void reset_route_counters() const {
+		for (RouteCounter& route_counter : _routes) {
+			route_counter.reset();
+		}
+	}
+	#endif
+
+
+	#ifdef ESP32
+
+	/**
+     * @brief Notifies a task waiting with `ulTaskNotifyTake`, from an ISR or not
+     * @param task The task to be notified
+     */
+	static void _notifyTask(TaskHandle_t task) {
+		if (xPortInIsrContext()) {
+			BaseType_t higher_priority_task_woken = pdFALSE;
+			vTaskNotifyGiveFromISR(task, &higher_priority_task_woken);
+			if (higher_priority_task_woken) portYIELD_FROM_ISR();
+		} else {
+			xTaskNotifyGive(task);
+		}
+	}
+
+
+	/**
+	 * @brief Starts the ESP32 dual core mode, where the Sockets receive and send in their own task
+	 *        while the routing and the Manifestos run in the `loop()` or `idleLoop()` calls
+	 * @param io_core The core of the Sockets task, by default 0 (the Arduino `loop()` runs in core 1)
+	 * @param stack_size The stack size of the Sockets task in bytes
+	 * @param priority The priority of the Sockets task
+	 * @return true if the Sockets task is running, false if it or the rings of the Sockets couldn't be created
+	 *
+	 * Both cores exchange the messages via lock-free rings of `TALKIE_RING_SIZE` slots per Socket
+	 * and direction, so, a Socket blocking transmission no longer stalls the Talkers.
+	 * Example:
+	 * ```
+	 * void setup() {
+	 *     // Sockets setup here
+	 *     message_repeater.beginDualCore();
+	 * }
+	 * ```
+	 * @note Without calling this method everything runs single threaded as usual.
+	 */
+	bool beginDualCore(BaseType_t io_core = 0, uint32_t stack_size = 4096, UBaseType_t priority = 1) const {
+		if (_io_task) return true;
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+			if (!_uplinked_sockets[socket_j]->_allocateRings()) return false;
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+			if (!_downlinked_sockets[socket_j]->_allocateRings()) return false;
+		}
+		TaskHandle_t io_task = nullptr;
+		if (xTaskCreatePinnedToCore(_ioTask, "TalkieIO", stack_size,
+				const_cast<MessageRepeater*>(this), priority, &io_task, io_core) != pdPASS) {
+			return false;
+		}
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+			_uplinked_sockets[socket_j]->_setIOTask(io_task);
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+			_downlinked_sockets[socket_j]->_setIOTask(io_task);
+		}
+		_io_task = io_task;
+		xTaskNotifyGive(io_task);	// All set, the I/O task can start
+		return true;
+	}
+
+	#endif
+
+
+	#ifdef __linux__
+
+	/**
+	 * @brief Starts the Linux event mode, where `idleLoop()` sleeps in `epoll_wait` until a Socket
+	 *        file descriptor is readable or the earliest timer is due, instead of spinning
+	 * @return true if all Sockets with a file descriptor were registered
+	 *
+	 * Only the Sockets signaled as readable are received, so, the idle CPU doesn't grow with the
+	 * amount of Sockets, while the ones without a file descriptor are still polled as usual.
+	 * Example:
+	 * ```
+	 * int main() {
+	 *     linux_socket.begin();	// Opens the file descriptor, it can also be reopened later
+	 *     message_repeater.beginEpoll();
+	 *     for (;;) message_repeater.idleLoop();
+	 * }
+	 * ```
+	 * @note Without calling this method the Sockets are polled as in any other board.
+	 *       Sockets opened or reopened afterwards are registered by their own `begin`.
+	 */
+	bool beginEpoll() const {
+		if (_epoll_fd >= 0) return true;
+		_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+		if (_epoll_fd < 0) return false;
+		_wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		epoll_event wake_event = {};
+		wake_event.events = EPOLLIN;
+		wake_event.data.ptr = nullptr;
+		if (_wake_fd < 0 || epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wake_fd, &wake_event) != 0) return false;
+		bool all_registered = true;
+		for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+			all_registered = _registerSocket(_uplinked_sockets[socket_j]) && all_registered;
+		}
+		for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+			all_registered = _registerSocket(_downlinked_sockets[socket_j]) && all_registered;
+		}
+		return all_registered;
+	}
+
+	#endif
+
+
 	/**
      * @brief Method intended to be called directly inside a sketch
 	 *        without the need of using a Talker
@@ -216,6 +693,11 @@ public:
      */
 	void _socketDownlink(BroadcastSocket &socket, JsonMessage &message) const {
 		BroadcastValue broadcast = message.get_broadcast_value();
+		uint8_t hop_count;
+		if (!_admitMessage(message, &hop_count)) return;
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[RouteValue::TALKIE_RT_SOCKET_DOWNLINK].messages;
+		#endif
 
 		// To downlinked nodes (BRIDGED uplinks process LOCAL messages too)
 		if (broadcast == BroadcastValue::TALKIE_BC_REMOTE || (broadcast == BroadcastValue::TALKIE_BC_LOCAL && socket.isBridged())) {
@@ -244,7 +726,7 @@ public:
 						const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 						if (strcmp(talker_name, from_name) != 0) {
 							JsonMessage message_copy(message);
-							_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+							_deliver(RouteValue::TALKIE_RT_SOCKET_DOWNLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 						}
 					}
 				}
@@ -259,7 +741,7 @@ public:
 								const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 								if (strcmp(talker_name, from_name) != 0) {
 									JsonMessage message_copy(message);
-									_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+									_deliver(RouteValue::TALKIE_RT_SOCKET_DOWNLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 								}
 							}
 						}
@@ -280,7 +762,7 @@ public:
 					for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
 						const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 						if (strcmp(talker_name, to_name) == 0 && strcmp(talker_name, from_name) != 0) {
-							_downlinked_talkers[talker_i]->handleTransmission(message, talker_match);
+							_deliver(RouteValue::TALKIE_RT_SOCKET_DOWNLINK, _downlinked_talkers[talker_i], message, talker_match);
 							return;
 						}
 					}
@@ -295,9 +777,11 @@ public:
 			Serial.print(millis() - message._reference_time);
 			#endif
 				
-			for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
-				// Sockets ONLY manipulate the checksum ('c')
-				_downlinked_sockets[socket_j]->_finishTransmission(message);
+			if (_spendHop(message, hop_count)) {
+				for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
+					// Sockets ONLY manipulate the checksum ('c')
+					_deliver(RouteValue::TALKIE_RT_SOCKET_DOWNLINK, _downlinked_sockets[socket_j], message);
+				}
 			}
 			
 			#ifdef MESSAGE_DEBUG_TIMING
@@ -319,6 +803,9 @@ public:
 	bool _talkerUplink(JsonTalker &talker, JsonMessage &message) const {
 
 		BroadcastValue broadcast = message.get_broadcast_value();
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[RouteValue::TALKIE_RT_TALKER_UPLINK].messages;
+		#endif
 
 		#ifdef MESSAGE_REPEATER_DEBUG
 		Serial.print(F("\t\t_talkerUplink1: "));
@@ -334,7 +821,7 @@ public:
 				bool sent_by_socket = false;
 				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 					// Sockets ONLY manipulate the checksum ('c')
-					if (_uplinked_sockets[socket_j]->_finishTransmission(message)) {
+					if (_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _uplinked_sockets[socket_j], message)) {
 						sent_by_socket = true;
 					}
 				}
@@ -355,12 +842,12 @@ public:
 						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
 							if (_downlinked_talkers[talker_i] != &talker) {
 								JsonMessage message_copy(message);
-								_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+								_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 							}
 						}
 						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count;) {
 							JsonMessage message_copy(message);
-							_uplinked_talkers[talker_i++]->handleTransmission(message_copy, talker_match);
+							_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _uplinked_talkers[talker_i++], message_copy, talker_match);
 						}
 					}
 					break;
@@ -373,7 +860,7 @@ public:
 									uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
 									if (talker_channel == to_channel) {
 										JsonMessage message_copy(message);
-										_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+										_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 									}
 								}
 							}
@@ -381,7 +868,7 @@ public:
 								uint8_t talker_channel = _uplinked_talkers[talker_i]->get_channel();
 								if (talker_channel == to_channel) {
 									JsonMessage message_copy(message);
-									_uplinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+									_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _uplinked_talkers[talker_i], message_copy, talker_match);
 								}
 							}
 						} else {
@@ -396,7 +883,7 @@ public:
 							if (_downlinked_talkers[talker_i] != &talker) {
 								const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 								if (strcmp(talker_name, to_name) == 0) {
-									_downlinked_talkers[talker_i]->handleTransmission(message, talker_match);
+									_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _downlinked_talkers[talker_i], message, talker_match);
 									return false;	// Not sent via Socket
 								}
 							}
@@ -404,7 +891,7 @@ public:
 						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 							const char* talker_name = _uplinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, to_name) == 0) {
-								_uplinked_talkers[talker_i]->handleTransmission(message, talker_match);
+								_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _uplinked_talkers[talker_i], message, talker_match);
 								return false;		// Not sent via Socket
 							}
 						}
@@ -417,14 +904,14 @@ public:
 				bool sent_by_socket = false;
 				for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
 					// Sockets ONLY manipulate the checksum ('c')
-					if (_downlinked_sockets[socket_j]->_finishTransmission(message)) {
+					if (_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _downlinked_sockets[socket_j], message)) {
 						sent_by_socket = true;
 					}
 				}
 				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 					if (_uplinked_sockets[socket_j]->isBridged()) {
 						// Sockets ONLY manipulate the checksum ('c')
-						if (_uplinked_sockets[socket_j]->_finishTransmission(message)) {
+						if (_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, _uplinked_sockets[socket_j], message)) {
 							sent_by_socket = true;
 						}
 					}
@@ -439,7 +926,7 @@ public:
 				uint8_t to_channel;
 				TalkerMatch talker_match = message._get_talker_match(to_name, &to_channel);
 
-				talker.handleTransmission(message, talker_match);
+				_deliver(RouteValue::TALKIE_RT_TALKER_UPLINK, &talker, message, talker_match);
 				return false;	// Not sent via Socket
 			}
 			break;
@@ -451,13 +938,20 @@ public:
 
 
 	/**
-     * @brief Transmits to the Repeater downlink a json message
+     * @brief Transmits to the Repeater uplink a json message
+     * @param socket The socket that is calling the method
      * @param message A json message to be transmitted
 	 * 
+     * @note The message isn't sent back to the calling socket, except if it's a hub.
      * @note This is intended to be called internally and not by the user code.
      */
-	void _socketUplink(JsonMessage &message) const {
+	void _socketUplink(BroadcastSocket &socket, JsonMessage &message) const {
 		BroadcastValue broadcast = message.get_broadcast_value();
+		uint8_t hop_count;
+		if (!_admitMessage(message, &hop_count)) return;
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[RouteValue::TALKIE_RT_SOCKET_UPLINK].messages;
+		#endif
 
 		switch (broadcast) {
 
@@ -468,9 +962,11 @@ public:
 				Serial.print(millis() - message._reference_time);
 				#endif
 				
-				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
-					// Sockets ONLY manipulate the checksum ('c')
-					_uplinked_sockets[socket_j]->_finishTransmission(message);
+				if (_spendHop(message, hop_count)) {
+					for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
+						// Sockets ONLY manipulate the checksum ('c')
+						_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _uplinked_sockets[socket_j], message);
+					}
 				}
 				
 				#ifdef MESSAGE_DEBUG_TIMING
@@ -505,14 +1001,14 @@ public:
 							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, from_name) != 0) {
 								JsonMessage message_copy(message);
-								_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+								_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 							}
 						}
 						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, from_name) != 0) {
 								JsonMessage message_copy(message);
-								_uplinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+								_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _uplinked_talkers[talker_i], message_copy, talker_match);
 							}
 						}
 					}
@@ -527,7 +1023,7 @@ public:
 									const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 									if (strcmp(talker_name, from_name) != 0) {
 										JsonMessage message_copy(message);
-										_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+										_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 									}
 								}
 							}
@@ -537,7 +1033,7 @@ public:
 									const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 									if (strcmp(talker_name, from_name) != 0) {
 										JsonMessage message_copy(message);
-										_uplinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+										_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _uplinked_talkers[talker_i], message_copy, talker_match);
 									}
 								}
 							}
@@ -552,14 +1048,14 @@ public:
 						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
 							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, to_name) == 0 && strcmp(talker_name, from_name) != 0) {
-								_downlinked_talkers[talker_i]->handleTransmission(message, talker_match);
+								_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _downlinked_talkers[talker_i], message, talker_match);
 								return;
 							}
 						}
 						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 							const char* talker_name = _uplinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, to_name) == 0 && strcmp(talker_name, from_name) != 0) {
-								_uplinked_talkers[talker_i]->handleTransmission(message, talker_match);
+								_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _uplinked_talkers[talker_i], message, talker_match);
 								return;
 							}
 						}
@@ -569,14 +1065,18 @@ public:
 					default: return;
 				}
 
+				if (!_spendHop(message, hop_count)) return;
 				for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
-					// Sockets ONLY manipulate the checksum ('c')
-					_downlinked_sockets[socket_j]->_finishTransmission(message);
+					// Split horizon, a message isn't repeated to where it came from, unless a hub
+					if (_downlinked_sockets[socket_j] != &socket || socket.isHub()) {
+						// Sockets ONLY manipulate the checksum ('c')
+						_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _downlinked_sockets[socket_j], message);
+					}
 				}
 				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 					if (_uplinked_sockets[socket_j]->isBridged()) {
 						// Sockets ONLY manipulate the checksum ('c')
-						_uplinked_sockets[socket_j]->_finishTransmission(message);
+						_deliver(RouteValue::TALKIE_RT_SOCKET_UPLINK, _uplinked_sockets[socket_j], message);
 					}
 				}
 			}
@@ -597,6 +1097,9 @@ public:
 	bool _talkerDownlink(JsonTalker &talker, JsonMessage &message) const {
 
 		BroadcastValue broadcast = message.get_broadcast_value();
+		#ifndef TALKIE_NO_SYSTEM_STATS
+		++_routes[RouteValue::TALKIE_RT_TALKER_DOWNLINK].messages;
+		#endif
 
 		#ifdef MESSAGE_REPEATER_DEBUG
 		Serial.print(F("\t\t_talkerDownlink1: "));
@@ -627,12 +1130,12 @@ public:
 					{
 						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count;) {
 							JsonMessage message_copy(message);
-							_downlinked_talkers[talker_i++]->handleTransmission(message_copy, talker_match);
+							_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _downlinked_talkers[talker_i++], message_copy, talker_match);
 						}
 						for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
 							if (_uplinked_talkers[talker_i] != &talker) {
 								JsonMessage message_copy(message);
-								_uplinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+								_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _uplinked_talkers[talker_i], message_copy, talker_match);
 							}
 						}
 					}
@@ -645,7 +1148,7 @@ public:
 								uint8_t talker_channel = _downlinked_talkers[talker_i]->get_channel();
 								if (talker_channel == to_channel) {
 									JsonMessage message_copy(message);
-									_downlinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+									_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _downlinked_talkers[talker_i], message_copy, talker_match);
 								}
 							}
 							for (uint8_t talker_i = 0; talker_i < _uplinked_talkers_count; ++talker_i) {
@@ -653,7 +1156,7 @@ public:
 									uint8_t talker_channel = _uplinked_talkers[talker_i]->get_channel();
 									if (talker_channel == to_channel) {
 										JsonMessage message_copy(message);
-										_uplinked_talkers[talker_i]->handleTransmission(message_copy, talker_match);
+										_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _uplinked_talkers[talker_i], message_copy, talker_match);
 									}
 								}
 							}
@@ -668,7 +1171,7 @@ public:
 						for (uint8_t talker_i = 0; talker_i < _downlinked_talkers_count; ++talker_i) {
 							const char* talker_name = _downlinked_talkers[talker_i]->get_name();
 							if (strcmp(talker_name, to_name) == 0) {
-								_downlinked_talkers[talker_i]->handleTransmission(message, talker_match);
+								_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _downlinked_talkers[talker_i], message, talker_match);
 								return false;		// Not sent via Socket
 							}
 						}
@@ -676,7 +1179,7 @@ public:
 							if (_uplinked_talkers[talker_i] != &talker) {
 								const char* talker_name = _uplinked_talkers[talker_i]->get_name();
 								if (strcmp(talker_name, to_name) == 0) {
-									_uplinked_talkers[talker_i]->handleTransmission(message, talker_match);
+									_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _uplinked_talkers[talker_i], message, talker_match);
 									return false;	// Not sent via Socket
 								}
 							}
@@ -690,14 +1193,14 @@ public:
 				bool sent_by_socket = false;
 				for (uint8_t socket_j = 0; socket_j < _downlinked_sockets_count; ++socket_j) {
 					// Sockets ONLY manipulate the checksum ('c')
-					if (_downlinked_sockets[socket_j]->_finishTransmission(message)) {
+					if (_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _downlinked_sockets[socket_j], message)) {
 						sent_by_socket = true;
 					}
 				}
 				for (uint8_t socket_j = 0; socket_j < _uplinked_sockets_count; ++socket_j) {
 					if (_uplinked_sockets[socket_j]->isBridged()) {
 						// Sockets ONLY manipulate the checksum ('c')
-						if (_uplinked_sockets[socket_j]->_finishTransmission(message)) {
+						if (_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, _uplinked_sockets[socket_j], message)) {
 							sent_by_socket = true;
 						}
 					}
@@ -712,7 +1215,7 @@ public:
 				uint8_t to_channel;
 				TalkerMatch talker_match = message._get_talker_match(to_name, &to_channel);
 			
-				talker.handleTransmission(message, talker_match);
+				_deliver(RouteValue::TALKIE_RT_TALKER_DOWNLINK, &talker, message, talker_match);
 				return false;	// Not sent via Socket
 			}
 			break;
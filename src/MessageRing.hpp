@@ -0,0 +1,102 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file MessageRing.hpp
+ * @brief Lock-free ring of `JsonMessage` slots with a single producer
+ *        and a single consumer.
+ *
+ * @warning This class does not use dynamic memory allocation.
+ *          All slots are fixed-size `JsonMessage` objects.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef MESSAGE_RING_HPP
+#define MESSAGE_RING_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+#include "JsonMessage.hpp"
+
+
+/**
+ * @class MessageRing
+ * @brief Passes `JsonMessage` copies between two tasks (ex. two ESP32 cores) without locks
+ *
+ * Only the producer moves the head and only the consumer moves the tail, so, as long as each
+ * side is used by a single task, no mutex is needed. One slot is always left empty to tell
+ * a full ring from an empty one, resulting in `N - 1` usable slots.
+ *
+ * @tparam N The number of slots of the ring (at least 2)
+ */
+template <uint8_t N>
+class MessageRing {
+	static_assert(N >= 2, "A MessageRing needs at least 2 slots");
+
+private:
+
+	JsonMessage _slots[N];
+	uint8_t _head = 0;	///< Next slot to be written, moved by the producer only
+	uint8_t _tail = 0;	///< Next slot to be read, moved by the consumer only
+
+public:
+
+	MessageRing() = default;
+
+    // Delete copy/move operations
+	MessageRing(const MessageRing&) = delete;
+	MessageRing& operator=(const MessageRing&) = delete;
+
+
+	/**
+	 * @brief Copies the message into the ring (producer side)
+	 * @param json_message The json message to be copied
+	 * @return false if the ring is full
+	 */
+	bool push(const JsonMessage& json_message) {
+		const uint8_t head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+		const uint8_t next_head = (uint8_t)((head + 1) % N);
+		if (next_head == __atomic_load_n(&_tail, __ATOMIC_ACQUIRE)) return false;
+		_slots[head] = json_message;
+		__atomic_store_n(&_head, next_head, __ATOMIC_RELEASE);	// Publishes the slot content
+		return true;
+	}
+
+
+	/**
+	 * @brief Copies the oldest message out of the ring (consumer side)
+	 * @param json_message The json message to be overwritten
+	 * @return false if the ring is empty
+	 */
+	bool pop(JsonMessage& json_message) {
+		const uint8_t tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+		if (tail == __atomic_load_n(&_head, __ATOMIC_ACQUIRE)) return false;
+		json_message = _slots[tail];
+		__atomic_store_n(&_tail, (uint8_t)((tail + 1) % N), __ATOMIC_RELEASE);	// Frees the slot
+		return true;
+	}
+
+
+	/** @brief Returns true if there is nothing to be popped */
+	bool empty() const {
+		return __atomic_load_n(&_tail, __ATOMIC_ACQUIRE) == __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+	}
+
+};
+
+
+#endif // MESSAGE_RING_HPP
@@ -41,6 +41,7 @@ using ErrorValue 		= TalkieCodes::ErrorValue;
 using ValueType 		= TalkieCodes::ValueType;
 using TraceMessage 		= JsonTalker::TraceMessage;
 using Action 			= JsonTalker::Action;
+using FlashAction 		= JsonTalker::FlashAction;
 
 
 /**
@@ -90,8 +91,19 @@ public:
 	 * 
 	 * The typical method is:
 	 * `const Action* _getActionsArray() const override { return actions; }`
+	 * 
+	 * @note Without this nor the flash getter overridden, the Manifesto is taken as having no Actions.
+     */
+    virtual const Action* _getActionsArray() const { return nullptr; }
+
+
+	/**
+     * @brief A getter to the actions array kept in flash (PROGMEM), used instead of `_getActionsArray`
+	 * 
+	 * The typical method, with the array declared before the class, is:
+	 * `const FlashAction* _getFlashActionsArray() const override { return actions; }`
      */
-    virtual const Action* _getActionsArray() const = 0;
+    virtual const FlashAction* _getFlashActionsArray() const { return nullptr; }
 
 	
 	/**
@@ -104,6 +116,33 @@ public:
         (void)talker;		// Silence unused parameter warning
 	}
 
+
+	/**
+     * @brief Returns how long the `_loop` method can wait before being called again
+     * @param talker Allows the access by the Manifesto to its owner Talker class
+     * @return The idle time in milliseconds, `0` means it must be called right away
+	 * 
+     * @note Only used by the Repeater `idleLoop`, a Manifesto with timings shorter than
+	 *       `TALKIE_IDLE_MAX_MS` in its `_loop` method should override it.
+     */
+    virtual uint32_t _idleTime(const JsonTalker& talker) const {
+        (void)talker;		// Silence unused parameter warning
+		return TALKIE_IDLE_MAX_MS;
+	}
+
+
+	/**
+     * @brief Method called when a timer started with the Talker `startTimer` method is due
+     * @param talker Allows the access by the Manifesto to its owner Talker class
+     * @param timer The due timer, to be compared with the Manifesto timers
+	 * 
+     * @note Periodic timers are already started again when this method is called.
+     */
+    virtual void _timer(JsonTalker& talker, TalkieTimer& timer) {
+        (void)talker;		// Silence unused parameter warning
+        (void)timer;		// Silence unused parameter warning
+	}
+
 	
     /**
      * @brief Returns the index Action for a given Action name
@@ -111,15 +150,78 @@ public:
      * @return The index number of the action or 255 if none was found
      */
     virtual uint8_t _actionIndex(const char* name) const {
+		const FlashAction* flash_actions = _getFlashActionsArray();
+		if (flash_actions) {
+			for (uint8_t i = 0; i < _actionsCount(); i++) {
+				if (strcmp_P(name, flash_actions[i].name) == 0) {
+					return i;
+				}
+			}
+			return 255;
+		}
+		const Action* actions = _getActionsArray();
+		if (!actions) return 255;
         for (uint8_t i = 0; i < _actionsCount(); i++) {
-            if (strcmp(_getActionsArray()[i].name, name) == 0) {
+            if (strcmp(actions[i].name, name) == 0) {
                 return i;
             }
         }
         return 255;
     }
+
+
+	/**
+     * @brief Sets the name and description of an Action as the values 1 and 2 of the message
+     * @param index The index of an existing Action
+     * @param json_message The `list` reply message
+     */
+	void _setActionPair(uint8_t index, JsonMessage& json_message) const {
+		const FlashAction* flash_actions = _getFlashActionsArray();
+		if (flash_actions) {
+			json_message.set_nth_value_string(1, FPSTR(flash_actions[index].name), TALKIE_NAME_LEN);
+			json_message.set_nth_value_string(2, FPSTR(flash_actions[index].desc), TALKIE_DESC_LEN);
+		} else if (const Action* actions = _getActionsArray()) {
+			json_message.set_nth_value_string(1, actions[index].name, TALKIE_NAME_LEN);
+			json_message.set_nth_value_string(2, actions[index].desc, TALKIE_MAX_LEN);
+		}
+	}
     
 
+    /**
+     * @brief Checks the values of a call against the arguments schema of an Action
+     * @param index The index of an existing Action
+     * @param arguments The decoded values of the call
+     * @return true if matching the schema or if the Action has none, false if there are no Actions at all
+     */
+	bool _checkArguments(uint8_t index, const JsonMessage::Arguments& arguments) const {
+		const FlashAction* flash_actions = _getFlashActionsArray();
+		const Action* actions = flash_actions ? nullptr : _getActionsArray();
+		if (!flash_actions && !actions) return false;
+		const char* schema = flash_actions ? flash_actions[index].args : actions[index].args;
+		if (!schema) return true;
+		char schema_char = flash_actions ? (char)pgm_read_byte(schema) : *schema;
+		if (schema_char == '\0') return true;
+		if (schema_char == '-') return arguments.present == 0;
+		uint8_t nth = 0;
+		for (; nth < 10 && schema_char != '\0'; ++nth) {
+			const ValueType value_type = arguments.get_type(nth);
+			if (value_type == ValueType::TALKIE_VT_VOID) {
+				if (schema_char >= 'a') return false;	// Lowercase, not optional
+			} else {
+				switch (schema_char | 0x20) {	// As lowercase
+					case 'n': if (value_type != ValueType::TALKIE_VT_INTEGER) return false; break;
+					case 's': if (value_type != ValueType::TALKIE_VT_STRING) return false; break;
+					case 'v': if (value_type == ValueType::TALKIE_VT_OTHER) return false; break;
+					default: return false;
+				}
+			}
+			++schema;
+			schema_char = flash_actions ? (char)pgm_read_byte(schema) : *schema;
+		}
+		return (arguments.present >> nth) == 0;	// No values beyond the schema
+	}
+
+
     /**
      * @brief Confirms the index Action for a given index Action
      * @param index The index of the Action to be confirmed
@@ -146,6 +248,24 @@ public:
         return false;
 	}
 
+
+    /**
+     * @brief Calls a given Action by it's index number with the values of the message already decoded
+     * @param index The index of the Action being called
+     * @param talker Allows the access by the Manifesto to its owner Talker class
+     * @param json_message The json message made available for manipulation
+     * @param arguments The values `0` to `9` decoded in a single pass, already checked against the Action schema
+     * @param talker_match The type of matching concerning the Talker call
+     * @return Returns true if the call if successful (roger) or false if not (negative)
+     * 
+     * @note By default calls `_actionByIndex`, so, it's only overridden by the Manifestos that use the arguments.
+     */
+    virtual bool _actionByArguments(uint8_t index, JsonTalker& talker, JsonMessage& json_message,
+			const JsonMessage::Arguments& arguments, TalkerMatch talker_match) {
+        (void)arguments;	// Silence unused parameter warning
+        return _actionByIndex(index, talker, json_message, talker_match);
+	}
+
 	
     /**
      * @brief The method that processes the received echoes of the messages sent
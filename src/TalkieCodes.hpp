@@ -28,14 +28,111 @@ https://github.com/ruiseixasm/JsonTalkie
 #include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
 
 
+// Profiles of the protocol engine, the default one has everything but the features left out of AVR boards
+// #define TALKIE_PROFILE_MINIMAL	///< Just `call`, `ping` and their echoes, for the slave Talkers of the smallest boards
+// #define TALKIE_PROFILE_FULL		///< Everything, even the per Action counters and the frame batching in AVR boards
+
+// Or just some parts of the protocol engine left out
+// #define TALKIE_NO_TALK			///< No `talk` replies
+// #define TALKIE_NO_CHANNEL		///< No `channel` replies, being the channel set by code only
+// #define TALKIE_NO_LIST			///< No `list` replies
+// #define TALKIE_NO_SYSTEM			///< No `system` replies at all
+// #define TALKIE_NO_SYSTEM_STATS	///< No `system` counters, meaning, `errors`, `calls`, `traffic`, `routes` and `timing`, neither the Socket and Repeater ones
+// #define TALKIE_NO_RECOVERY		///< No resend of the last message on a checksum error, saving a message buffer per Talker
+// #define TALKIE_NO_BATCHING		///< No frame batching by the datagram Sockets, saving its fields in every Socket
+
+#if defined(TALKIE_PROFILE_MINIMAL) && defined(TALKIE_PROFILE_FULL)
+#error "Only one TALKIE_PROFILE can be defined"
+#endif
+
+#ifdef TALKIE_PROFILE_MINIMAL
+#ifndef TALKIE_NO_TALK
+#define TALKIE_NO_TALK
+#endif
+#ifndef TALKIE_NO_CHANNEL
+#define TALKIE_NO_CHANNEL
+#endif
+#ifndef TALKIE_NO_LIST
+#define TALKIE_NO_LIST
+#endif
+#ifndef TALKIE_NO_SYSTEM
+#define TALKIE_NO_SYSTEM
+#endif
+#ifndef TALKIE_NO_SYSTEM_STATS
+#define TALKIE_NO_SYSTEM_STATS
+#endif
+#ifndef TALKIE_NO_RECOVERY
+#define TALKIE_NO_RECOVERY
+#endif
+#endif
+
+#if (defined(TALKIE_PROFILE_MINIMAL) || (defined(__AVR__) && !defined(TALKIE_PROFILE_FULL))) && !defined(TALKIE_NO_BATCHING)
+#define TALKIE_NO_BATCHING			// The 1 KB of batch buffers of a datagram Socket don't fit in most AVR boards anyway
+#endif
+
 
 #define TALKIE_BUFFER_SIZE 128	    ///< Default buffer size for JSON message, you can use 160 or 192 if necessary
 #define TALKIE_NAME_LEN 11			///< Default maximum length for name fields, real size is (TALKIE_NAME_LEN - 1)
 #define TALKIE_MAX_LEN 54			///< Default maximum length for string fields
+#define TALKIE_DESC_LEN 40			///< Size of a flash Action description, real size is (TALKIE_DESC_LEN - 1)
+#define TALKIE_ARGS_LEN 6			///< Size of a flash Action arguments schema, real size is (TALKIE_ARGS_LEN - 1)
 #define TALKIE_MAX_RETRIES 3		///< The maximum amount of retires for a not received message (checksum error)
 #define TALKIE_TRACE_TTL 60000		///< The maximum time to live of the traceable message (1 minute)
+#if defined(TALKIE_PROFILE_MINIMAL) || (defined(__AVR__) && !defined(TALKIE_PROFILE_FULL))
+#define TALKIE_TRACE_SIZE 2			///< Just the last couple of sent messages paired with their echoes
+#else
+#define TALKIE_TRACE_SIZE 8			///< The outstanding messages of each Talker able to be paired with their echoes
+#endif
 #define TALKIE_RECOVERY_TTL 500		///< The maximum time to live of the recoverable message (half a second)
 #define MAXIMUM_CONSECUTIVE_ERRORS 3		///< The maximum number of subsequent errors able to be triggered
+#define TALKIE_IDLE_MAX_MS 10		///< The maximum time the Repeater `idleLoop` waits for an event (10 milliseconds)
+#define TALKIE_POLL_INTERVAL_MS 1	///< The waiting time while idle for Sockets that can only be polled (1 millisecond)
+#define TALKIE_RING_SIZE 8			///< The slots of each Socket ring between cores in dual core mode (ESP32 only)
+#define TALKIE_EPOLL_EVENTS 16		///< The ready Sockets handled by each `epoll_wait` of the Repeater (Linux only)
+#define TALKIE_BATCH_SIZE 512		///< Maximum size of a datagram with batched frames, keep it below the 1472 bytes of an UDP payload
+#define TALKIE_MAX_HOPS 4			///< The Socket to Socket hops a message can do across Repeaters (single digit)
+#if defined(__AVR__) && !defined(TALKIE_PROFILE_FULL)
+#define TALKIE_DEDUP_SIZE 4			///< Just the last messages of each Repeater of an AVR board checked for duplicates
+#else
+#define TALKIE_DEDUP_SIZE 8			///< The messages each Repeater remembers to drop their duplicates, 0 disables it
+#endif
+#define TALKIE_DEDUP_TTL 100		///< The time a remembered message is able to drop its duplicates (100 milliseconds)
+#if defined(__AVR__) && !defined(TALKIE_PROFILE_FULL)
+#define TALKIE_WHEEL_BITS 3			///< Just 8 slots per level in AVR boards, where each slot takes 2 bytes of RAM
+#define TALKIE_WHEEL_LEVELS 2		///< Spanning 64 milliseconds, with the longer timers placed again each time they reach the span
+#else
+#define TALKIE_WHEEL_BITS 4			///< Each level of the Timer wheel has 2^bits slots (16 slots)
+#define TALKIE_WHEEL_LEVELS 4		///< The Timer wheel levels, spanning 2^(bits * levels) milliseconds (65 seconds)
+#endif
+#if defined(__AVR__) || defined(TALKIE_PROFILE_MINIMAL)
+#define TALKIE_REPLY_CACHE 0		///< The scarce AVR RAM isn't used to cache the serialized `talk` and `list` replies
+#else
+#define TALKIE_REPLY_CACHE 512		///< Bytes of serialized `talk` and `list` replies cached by each Talker, 0 disables it
+#endif
+#ifdef TALKIE_PROFILE_MINIMAL
+#define TALKIE_PENDING_CALLS 0		///< No `call` requests, only answers
+#elif defined(__AVR__)
+#define TALKIE_PENDING_CALLS 2		///< Just a couple of `call` requests waiting for their echoes in the scarce AVR RAM
+#else
+#define TALKIE_PENDING_CALLS 8		///< The `call` requests of each Talker waiting for their echoes at once, 0 disables it
+#endif
+#define TALKIE_CALL_TIMEOUT 1000	///< The default time a `call` request waits for its echo (1 second)
+#if defined(TALKIE_PROFILE_MINIMAL) || (defined(__AVR__) && !defined(TALKIE_PROFILE_FULL))
+#define TALKIE_ACTION_STATS 0		///< No per Action counters in AVR boards, where each Action would take 20 bytes of RAM
+#elif defined(__AVR__)
+#define TALKIE_ACTION_STATS 8		///< Just the first Actions counted in AVR boards
+#else
+#define TALKIE_ACTION_STATS 16		///< The first Actions with their calls and execution time counted, 0 disables it
+#endif
+#define TALKIE_STATS_PAGE 4			///< The Actions listed by each page of the `system` value `calls`
+#ifdef TALKIE_PROFILE_MINIMAL
+#define TALKIE_PEERS_SIZE 1			///< Just the last Talker heard is replied in unicast, like a single reply address
+#elif defined(__AVR__)
+#define TALKIE_PEERS_SIZE 2			///< A couple of controllers replied in unicast by the UDP Sockets of AVR boards
+#else
+#define TALKIE_PEERS_SIZE 8			///< The Talkers heard by each UDP Socket that are replied in unicast instead of broadcast
+#endif
+#define TALKIE_PEERS_TTL 60000		///< The time a Talker not heard again keeps being replied in unicast (1 minute)
 
 
 /**
@@ -146,7 +243,34 @@ struct TalkieCodes {
         TALKIE_SYS_MUTE,      ///< Returns or sets the mute mode
         TALKIE_SYS_DELAY,     ///< Network delay configuration
         TALKIE_SYS_ERRORS,    ///< Represents all Socket errors (lost, recoveries, drops and fails)
-        TALKIE_SYS_CALLS      ///< Represents all Talker calls (total, rogers, negatives and says again)
+        TALKIE_SYS_CALLS,     ///< Represents all Talker calls (total, rogers, negatives and says again)
+        TALKIE_SYS_TRAFFIC,   ///< Represents all Socket traffic (messages in, messages out and bytes sent)
+        TALKIE_SYS_ROUTES,    ///< Represents all Repeater routes (messages and deliveries)
+        TALKIE_SYS_TIMING     ///< Represents all Socket timings (total, maximum and samples) per `TimingValue`
+    };
+
+
+    /**
+     * @enum RouteValue
+     * @brief The Repeater routes, named by their source and direction
+     */
+    enum RouteValue : uint8_t {
+        TALKIE_RT_SOCKET_DOWNLINK,	///< From uplinked Sockets to the downlinked nodes
+        TALKIE_RT_SOCKET_UPLINK,	///< From downlinked Sockets to the uplinked nodes
+        TALKIE_RT_TALKER_UPLINK,	///< From Talkers to the uplinked nodes
+        TALKIE_RT_TALKER_DOWNLINK	///< From Talkers to the downlinked nodes
+    };
+
+
+    /**
+     * @enum TimingValue
+     * @brief The Socket processing steps being timed, each one includes the following ones
+     */
+    enum TimingValue : uint8_t {
+        TALKIE_TM_RECEIVE,	///< The `_receive` method, polls included
+        TALKIE_TM_START,	///< The `_startTransmission` method, the message validation
+        TALKIE_TM_ROUTE,	///< The routing by the Repeater, the deliveries included
+        TALKIE_TM_SEND		///< The `_send` method
     };
 
 
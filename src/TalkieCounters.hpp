@@ -0,0 +1,115 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file TalkieCounters.hpp
+ * @brief Performance counters of the Sockets, of the Repeater routes and of the Actions,
+ *        remotely queried with the `system` values `traffic`, `routes`, `timing` and `calls`.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef TALKIE_COUNTERS_HPP
+#define TALKIE_COUNTERS_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+
+
+/**
+ * @struct TimingCounter
+ * @brief Cumulative and maximum time spent in a given processing step
+ */
+struct TimingCounter {
+	uint32_t total_us = 0;		///< Cumulative microseconds (wraps after ~71 minutes of processing)
+	uint32_t max_us = 0;		///< The longest single run in microseconds
+	uint32_t samples = 0;		///< The amount of runs measured
+
+	void add(uint32_t elapsed_us) {
+		total_us += elapsed_us;
+		if (elapsed_us > max_us) max_us = elapsed_us;
+		++samples;
+	}
+
+	void reset() {
+		total_us = 0;
+		max_us = 0;
+		samples = 0;
+	}
+};
+
+
+/**
+ * @class TimingScope
+ * @brief Adds to a `TimingCounter` the time elapsed since its creation until going out of scope,
+ *        early returns included
+ */
+class TimingScope {
+private:
+
+	TimingCounter& _counter;
+	const uint32_t _start_us;
+
+public:
+
+	explicit TimingScope(TimingCounter& counter) : _counter(counter), _start_us(micros()) {}
+
+	~TimingScope() {
+		_counter.add(micros() - _start_us);
+	}
+
+	TimingScope(const TimingScope&) = delete;
+	TimingScope& operator=(const TimingScope&) = delete;
+};
+
+
+/**
+ * @struct RouteCounter
+ * @brief The messages taken by a Repeater route and the nodes they were delivered to
+ *
+ * @note The fan-out of the route is given by `deliveries / messages`.
+ */
+struct RouteCounter {
+	uint32_t messages = 0;		///< Messages routed
+	uint32_t deliveries = 0;	///< Deliveries to Talkers and Sockets
+
+	void reset() {
+		messages = 0;
+		deliveries = 0;
+	}
+};
+
+
+/**
+ * @struct ActionCounter
+ * @brief The results of the calls of an Action and the time spent running it
+ *
+ * @note A deferred call has its time counted when run and its result when completed.
+ */
+struct ActionCounter {
+	uint32_t rogers = 0;		///< Calls with a `roger` result
+	uint32_t negatives = 0;		///< Calls with a `negative` result
+	TimingCounter timing;		///< Time spent in the Action, being `samples` the calls run
+
+	void reset() {
+		rogers = 0;
+		negatives = 0;
+		timing.reset();
+	}
+};
+
+
+#endif // TALKIE_COUNTERS_HPP
@@ -0,0 +1,117 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file TalkieFrames.hpp
+ * @brief The `{...}` framing of the stream Sockets, like the Serial ones, where the
+ *        received bytes are taken in chunks instead of one by one.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef TALKIE_FRAMES_HPP
+#define TALKIE_FRAMES_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+#include "JsonMessage.hpp"
+
+
+/**
+ * @class FrameReader
+ * @brief Takes the json frames out of a stream of bytes read in chunks
+ *
+ * The bytes are written straight into its buffer, and then each frame is found with `memchr`,
+ * from the `{` to the first `}` not escaped by a `\`. A partial frame is kept at the start of
+ * the buffer until the rest of it is read, while the bytes out of any frame are skipped.
+ *
+ * @note A frame that doesn't fit in `TALKIE_BUFFER_SIZE` is dropped, like in a `JsonMessage`.
+ */
+class FrameReader {
+private:
+
+	char _received[TALKIE_BUFFER_SIZE];
+	size_t _received_length = 0;
+	size_t _scanned_length = 0;		// Already searched for the closing '}'
+	bool _in_frame = false;			// A partial frame starts at the buffer start
+
+
+	void _consume(size_t length) {
+		_received_length -= length;
+		memmove(_received, _received + length, _received_length);
+	}
+
+
+public:
+
+	/** @brief Where the read bytes are written to, followed by `add_length` */
+	char* get_free_space() { return _received + _received_length; }
+
+	/** @brief The bytes that can be read at once, never 0 after `take_frame` returned false */
+	size_t get_free_length() const { return TALKIE_BUFFER_SIZE - _received_length; }
+
+	/** @brief Adds the bytes written in the free space */
+	void add_length(size_t length) { _received_length += length; }
+
+
+	/**
+     * @brief Takes the next complete frame, if any
+     * @param json_message The message where the frame is written to
+     * @return false if there is no complete frame left, so, more bytes have to be read
+     */
+	bool take_frame(JsonMessage& json_message) {
+		while (true) {
+			if (!_in_frame) {
+				const char* frame_open = static_cast<const char*>(memchr(_received, '{', _received_length));
+				if (!frame_open) {
+					_received_length = 0;	// Nothing to keep
+					return false;
+				}
+				_consume(frame_open - _received);
+				_scanned_length = 1;
+				_in_frame = true;
+			}
+			const char* frame_close = static_cast<const char*>(
+				memchr(_received + _scanned_length, '}', _received_length - _scanned_length)
+			);
+			if (!frame_close) {
+				_scanned_length = _received_length;
+				if (_received_length == TALKIE_BUFFER_SIZE) {	// A frame too big for any message
+					_received_length = 0;
+					_in_frame = false;
+				}
+				return false;
+			}
+			_scanned_length = frame_close - _received + 1;
+			if (frame_close[-1] == '\\') continue;	// An escaped '}' inside a string
+			memcpy(json_message._write_buffer(_scanned_length), _received, _scanned_length);
+			json_message._set_length(_scanned_length);
+			_consume(_scanned_length);
+			_in_frame = false;
+			return true;
+		}
+	}
+
+
+	/** @brief Drops any partial frame, like after reopening the stream */
+	void reset() {
+		_received_length = 0;
+		_in_frame = false;
+	}
+};
+
+
+#endif // TALKIE_FRAMES_HPP
@@ -0,0 +1,156 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file TalkiePeers.hpp
+ * @brief The addresses of the Talkers heard by an UDP Socket, so that the messages sent
+ *        to any of them by name go in unicast instead of waking up the whole LAN.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef TALKIE_PEERS_HPP
+#define TALKIE_PEERS_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+#include "JsonMessage.hpp"
+
+
+/**
+ * @class PeerTable
+ * @brief A least recently heard table of `TALKIE_PEERS_SIZE` Talker names and their IPv4 addresses
+ *
+ * A Talker is learned from the `from` name of each received message, and when the table is full it
+ * replaces the Talker heard the longest time ago. A Talker not heard for `TALKIE_PEERS_TTL` is no
+ * longer used (aging), given that its address may have changed meanwhile.
+ *
+ * @note The address is kept as the `uint32_t` of an `IPAddress`, so, with the same byte order.
+ */
+class PeerTable {
+private:
+
+	struct Peer {
+		char name[TALKIE_NAME_LEN] = {'\0'};
+		uint32_t ip_address = 0;
+		uint32_t heard_time = 0;	// millis() compatible
+	};
+
+	Peer _peers[TALKIE_PEERS_SIZE];
+	uint16_t _hits = 0;
+	uint16_t _misses = 0;
+
+
+	static bool _isAlive(const Peer& peer, uint32_t present_time) {
+		return peer.name[0] != '\0' && present_time - peer.heard_time < TALKIE_PEERS_TTL;
+	}
+
+
+public:
+
+	/**
+     * @brief Keeps the address of the Talker that sent the message, if it has a `from` name
+     * @param json_message A received json message
+     * @param ip_address The source address of the message
+     */
+	void learn(const JsonMessage& json_message, uint32_t ip_address) {
+		char from_name[TALKIE_NAME_LEN];
+		if (!json_message.get_from_name(from_name) || from_name[0] == '\0') return;
+		const uint32_t present_time = millis();
+		uint8_t slot = 0;
+		uint32_t slot_age = 0;
+		for (uint8_t peer_i = 0; peer_i < TALKIE_PEERS_SIZE; ++peer_i) {
+			const Peer& peer = _peers[peer_i];
+			if (strcmp(peer.name, from_name) == 0) {
+				slot = peer_i;
+				break;
+			}
+			// A free or aged slot is the oldest of all
+			const uint32_t age = _isAlive(peer, present_time) ? present_time - peer.heard_time : 0xFFFFFFFF;
+			if (age >= slot_age) {
+				slot = peer_i;
+				slot_age = age;
+			}
+		}
+		strcpy(_peers[slot].name, from_name);
+		_peers[slot].ip_address = ip_address;
+		_peers[slot].heard_time = present_time;
+	}
+
+
+	/**
+     * @brief Looks up the address of the Talker a message is sent to by name, counting a hit or a miss
+     * @param json_message A json message about to be sent
+     * @param ip_address Returns the address of the Talker, if known
+     * @return true if the Talker is known and the message can be sent in unicast
+	 *
+     * @note Messages not sent to a name, like the ones to a channel, aren't counted.
+     */
+	bool find(const JsonMessage& json_message, uint32_t* ip_address) {
+		char to_name[TALKIE_NAME_LEN];
+		if (!json_message.get_to_name(to_name)) return false;
+		const uint32_t present_time = millis();
+		for (uint8_t peer_i = 0; peer_i < TALKIE_PEERS_SIZE; ++peer_i) {
+			const Peer& peer = _peers[peer_i];
+			if (_isAlive(peer, present_time) && strcmp(peer.name, to_name) == 0) {
+				*ip_address = peer.ip_address;
+				++_hits;
+				return true;
+			}
+		}
+		++_misses;
+		return false;
+	}
+
+
+	/** @brief Forgets all Talkers, like when some Socket in the LAN changed its address (noise) */
+	void forget() {
+		for (Peer& peer : _peers) {
+			peer.name[0] = '\0';
+		}
+	}
+
+
+	/** @brief The Talkers heard within the last `TALKIE_PEERS_TTL` */
+	uint8_t get_count() const {
+		const uint32_t present_time = millis();
+		uint8_t count = 0;
+		for (const Peer& peer : _peers) {
+			if (_isAlive(peer, present_time)) ++count;
+		}
+		return count;
+	}
+
+	/** @brief The messages to a name sent in unicast */
+	uint16_t get_hits() const { return _hits; }
+
+	/** @brief The messages to a name sent in broadcast because the Talker wasn't known */
+	uint16_t get_misses() const { return _misses; }
+
+	/** @brief The percentage of messages to a name sent in unicast, 0 if none was sent */
+	uint8_t get_hit_rate() const {
+		const uint32_t total = (uint32_t)_hits + _misses;
+		return total ? (uint8_t)((uint32_t)_hits * 100 / total) : 0;
+	}
+
+	void reset_counters() {
+		_hits = 0;
+		_misses = 0;
+	}
+};
+
+
+#endif // TALKIE_PEERS_HPP
@@ -0,0 +1,265 @@
+/*
+JsonTalkie - Json Talkie is intended for direct IoT communication.
+Original Copyright (c) 2025 Rui Seixas Monteiro. All right reserved.
+This library is free software; you can redistribute it and/or
+modify it under the terms of the GNU Lesser General Public
+License as published by the Free Software Foundation; either
+version 2.1 of the License, or (at your option) any later version.
+This library is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+Lesser General Public License for more details.
+https://github.com/ruiseixasm/JsonTalkie
+*/
+
+
+/**
+ * @file TalkieTimers.hpp
+ * @brief Timers of the Talkers and Manifestos kept in a single hierarchical timer wheel,
+ *        so that only the due ones are run and no `millis()` polling is needed per Talker.
+ *
+ * @author Rui Seixas Monteiro
+ * @date Created: 2026-10-18
+ * @version 1.0.0
+ */
+
+#ifndef TALKIE_TIMERS_HPP
+#define TALKIE_TIMERS_HPP
+
+#include <Arduino.h>        // Needed for Serial given that Arduino IDE only includes Serial in .ino files!
+#include "TalkieCodes.hpp"
+
+
+static_assert(TALKIE_WHEEL_BITS * TALKIE_WHEEL_LEVELS < 32, "The Timer wheel span has to fit in 32 bits of milliseconds");
+
+
+class TimerWheel;
+
+
+/**
+ * @class TalkieTimer
+ * @brief A one-shot or periodic timer, owned by whoever starts it, that costs no RAM to the wheel
+ *
+ * @note A timer is linked in the wheel while pending, so, it must outlive its pending time.
+ */
+class TalkieTimer {
+public:
+
+	/** @brief The function called when the timer is due, with the `context` given when started */
+	typedef void (*Callback)(TalkieTimer& timer, void* context);
+
+	TalkieTimer() {}
+
+	// A copy is never pending, so that the owner can still be copied
+	TalkieTimer(const TalkieTimer&) {}
+	TalkieTimer& operator=(const TalkieTimer&) { return *this; }
+
+	/** @brief true while started and not yet due (or while periodic) */
+	bool is_pending() const { return _pprev != nullptr; }
+
+	/** @brief The `millis()` time when it's due */
+	uint32_t get_deadline() const { return _deadline; }
+
+	/** @brief The period in milliseconds, 0 if it's a one-shot timer */
+	uint32_t get_period() const { return _period; }
+
+private:
+
+	friend class TimerWheel;
+
+	TalkieTimer* _next = nullptr;
+	TalkieTimer** _pprev = nullptr;		// The pointer that points to this timer, nullptr if not pending
+	uint32_t _deadline = 0;
+	uint32_t _period = 0;
+	Callback _callback = nullptr;
+	void* _context = nullptr;
+};
+
+
+/**
+ * @class TimerWheel
+ * @brief The wheel shared by all Talkers and Manifestos, advanced and queried by the Repeater
+ *
+ * Each level has `2^TALKIE_WHEEL_BITS` slots, the first level with a slot per millisecond, and
+ * each next level with a slot per full turn of the previous one. A timer is placed at the level
+ * its deadline fits in and cascades down to the lower levels as the time gets near to it.
+ * Starting and stopping a timer is O(1), and each millisecond only a single slot is run.
+ */
+class TimerWheel {
+private:
+
+	static const uint8_t SLOTS = 1 << TALKIE_WHEEL_BITS;
+	static const uint8_t MASK = SLOTS - 1;
+
+	TalkieTimer* _slots[TALKIE_WHEEL_LEVELS][SLOTS];
+	uint32_t _time = 0;			// The last millisecond run
+	uint16_t _pending = 0;
+
+
+	TimerWheel() {
+		for (uint8_t level = 0; level < TALKIE_WHEEL_LEVELS; ++level) {
+			for (uint8_t slot = 0; slot < SLOTS; ++slot) {
+				_slots[level][slot] = nullptr;
+			}
+		}
+	}
+
+	TimerWheel(const TimerWheel&) = delete;
+	TimerWheel& operator=(const TimerWheel&) = delete;
+
+
+	/** @brief Links the timer in the slot of the level its deadline fits in */
+	void _link(TalkieTimer& timer) {
+		uint32_t target = timer._deadline;
+		uint32_t delta = target - _time;
+		if (delta >= 1UL << (TALKIE_WHEEL_BITS * TALKIE_WHEEL_LEVELS)) {	// Beyond the span, it's placed again when reached
+			delta = (uint32_t)MASK << (TALKIE_WHEEL_BITS * (TALKIE_WHEEL_LEVELS - 1));
+			target = _time + delta;
+		}
+		uint8_t level = 0;
+		while (level < TALKIE_WHEEL_LEVELS - 1 && delta >= 1UL << (TALKIE_WHEEL_BITS * (level + 1))) {
+			++level;
+		}
+		TalkieTimer** head = &_slots[level][(target >> (TALKIE_WHEEL_BITS * level)) & MASK];
+		timer._next = *head;
+		if (timer._next) timer._next->_pprev = &timer._next;
+		timer._pprev = head;
+		*head = &timer;
+	}
+
+
+	/** @brief Unlinks the timer from its slot */
+	static void _unlink(TalkieTimer& timer) {
+		*timer._pprev = timer._next;
+		if (timer._next) timer._next->_pprev = timer._pprev;
+		timer._next = nullptr;
+		timer._pprev = nullptr;
+	}
+
+
+	/** @brief Places again the timers of the reached slot of a level in the lower levels */
+	void _cascade(uint8_t level) {
+		TalkieTimer** head = &_slots[level][(_time >> (TALKIE_WHEEL_BITS * level)) & MASK];
+		TalkieTimer* timer = *head;
+		*head = nullptr;
+		while (timer) {
+			TalkieTimer* next = timer->_next;
+			_link(*timer);
+			timer = next;
+		}
+	}
+
+
+public:
+
+	/** @brief The single wheel shared by all Talkers and Manifestos */
+	static TimerWheel& instance() {
+		static TimerWheel wheel;
+		return wheel;
+	}
+
+
+	/**
+     * @brief Starts (or restarts) a timer
+     * @param timer The timer to be started
+     * @param delay_ms The time in milliseconds from now until it's due, at least 1 millisecond
+     * @param period_ms The period in milliseconds to be run again, 0 for a one-shot timer
+     * @param callback The function called when due
+     * @param context Anything given to the callback, like the object owning the timer
+     */
+	void start(TalkieTimer& timer, uint32_t delay_ms, uint32_t period_ms, TalkieTimer::Callback callback, void* context = nullptr) {
+		const uint32_t present_time = millis();
+		if (timer._pprev) {
+			_unlink(timer);
+		} else {
+			if (_pending == 0) _time = present_time;	// Nothing to catch up with
+			++_pending;
+		}
+		timer._deadline = present_time + delay_ms;
+		if ((int32_t)(timer._deadline - _time) <= 0) timer._deadline = _time + 1;
+		timer._period = period_ms;
+		timer._callback = callback;
+		timer._context = context;
+		_link(timer);
+	}
+
+
+	/** @brief Stops a timer, if pending */
+	void stop(TalkieTimer& timer) {
+		if (timer._pprev) {
+			_unlink(timer);
+			--_pending;
+		}
+	}
+
+
+	/** @brief The amount of pending timers */
+	uint16_t get_pending_count() const { return _pending; }
+
+
+	/**
+     * @brief Runs every millisecond up to the given time, calling the due timers
+     * @param present_time The actual `millis()` time
+	 *
+     * @note This is intended to be called by the Repeater loop and not by the user code.
+     */
+	void _advance(uint32_t present_time) {
+		while ((int32_t)(present_time - _time) > 0) {
+			if (_pending == 0) {
+				_time = present_time;
+				return;
+			}
+			++_time;
+			// A full turn of the lower levels reaches the next slot of the level above, top down
+			uint8_t level = 1;
+			while (level < TALKIE_WHEEL_LEVELS && (_time & ((1UL << (TALKIE_WHEEL_BITS * level)) - 1)) == 0) {
+				++level;
+			}
+			while (--level > 0) {
+				_cascade(level);
+			}
+			TalkieTimer** head = &_slots[0][_time & MASK];
+			while (*head) {
+				TalkieTimer& timer = **head;
+				_unlink(timer);
+				if (timer._period > 0) {
+					timer._deadline += timer._period;
+					if ((int32_t)(timer._deadline - _time) <= 0) timer._deadline = _time + 1;	// Skips the missed runs
+					_link(timer);
+				} else {
+					--_pending;
+				}
+				timer._callback(timer, timer._context);	// Can start or stop any timer
+			}
+		}
+	}
+
+
+	/**
+     * @brief Returns how long the Repeater can stay idle until the next due timer
+     * @param present_time The actual `millis()` time
+     * @return The idle time in milliseconds, `0` means some timer is due, `TALKIE_IDLE_MAX_MS` if none is pending
+	 *
+     * @note For the higher levels it's the time until their cascading, which comes before their deadlines.
+     */
+	uint32_t _idleTime(uint32_t present_time) const {
+		if (_pending == 0) return TALKIE_IDLE_MAX_MS;
+		uint32_t next_time = _time + TALKIE_IDLE_MAX_MS;
+		for (uint8_t level = 0; level < TALKIE_WHEEL_LEVELS; ++level) {
+			const uint8_t shift = TALKIE_WHEEL_BITS * level;
+			for (uint8_t turn = 1; turn <= SLOTS; ++turn) {
+				const uint32_t slot_time = ((_time >> shift) + turn) << shift;
+				if ((int32_t)(slot_time - next_time) >= 0) break;
+				if (_slots[level][(slot_time >> shift) & MASK]) {
+					next_time = slot_time;
+					break;
+				}
+			}
+		}
+		if ((int32_t)(next_time - present_time) <= 0) return 0;
+		return next_time - present_time;
+	}
+};
+
+
+#endif // TALKIE_TIMERS_HPP